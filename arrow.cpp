@@ -0,0 +1,87 @@
+#include "meta.h"
+#include "bounded.h"
+#include "arrow.h"
+#include <fstream>
+#include <iostream>
+
+// ============================================================================
+// RECORD TYPE
+// ============================================================================
+
+enum class Side { Buy, Sell };
+
+template <>
+struct meta::EnumMapping<Side> {
+    static constexpr std::array mapping = std::array{
+        std::pair(Side::Buy, "buy"),
+        std::pair(Side::Sell, "sell"),
+    };
+    using Type = meta::EnumTraitsAuto<Side, mapping>;
+};
+
+struct Venue {
+    meta::BoundedString<1, 8> code;
+    std::string city;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Venue::code>("code", "Exchange code", meta::RequiredField),
+        meta::Field<&Venue::city>("city", "Exchange city", meta::OptionalField)
+    };
+};
+
+struct Trade {
+    int64_t id = 0;
+    std::string symbol;
+    Side side = Side::Buy;
+    meta::BoundedInt<1, 10000> quantity{1};
+    double price = 0;
+    bool settled = false;
+    Venue venue;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Trade::id>("id", "Trade id", meta::RequiredField),
+        meta::Field<&Trade::symbol>("symbol", "Ticker", meta::RequiredField),
+        meta::Field<&Trade::side>("side", "Buy or sell", meta::RequiredField),
+        meta::Field<&Trade::quantity>("quantity", "Shares", meta::RequiredField),
+        meta::Field<&Trade::price>("price", "Price per share", meta::RequiredField),
+        meta::Field<&Trade::settled>("settled", "Settlement done", meta::OptionalField),
+        meta::Field<&Trade::venue>("venue", "Where it traded", meta::OptionalField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Arrow Export ===\n\n";
+
+    const char* symbols[] = {"ACME", "GLOBEX", "INITECH", "UMBRELLA"};
+    std::vector<Trade> trades;
+    for (int i = 0; i < 100000; i++) {
+        Trade t;
+        t.id = 1'000'000'000'000LL + i;
+        t.symbol = symbols[i % 4];
+        t.side = i % 3 == 0 ? Side::Sell : Side::Buy;
+        t.quantity.set(1 + i % 10000);
+        t.price = 100.0 + (i % 500) * 0.25;
+        t.settled = i % 2 == 0;
+        t.venue.code.val = i % 2 ? "XNYS" : "XLON";
+        t.venue.city = i % 2 ? "New York" : "London";
+        trades.push_back(std::move(t));
+    }
+
+    const char* path = "trades.arrow";
+    {
+        std::ofstream out(path, std::ios::binary);
+        meta::writeArrow(trades, out, {.batchRows = 32768});
+    }
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    std::cout << "✓ " << trades.size() << " trades -> " << path << " (" << in.tellg() / 1024 << " KiB, "
+              << (trades.size() + 32767) / 32768 << " record batches)\n";
+    std::cout << "  read back with: pyarrow.ipc.open_file(\"" << path << "\").read_all()\n";
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,672 @@
+#pragma once
+
+#include "meta.h"
+#include "bounded.h"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// ARROW EXPORT - records to an Arrow IPC file, one column per Field
+// ============================================================================
+//
+//   std::ofstream out("users.arrow", std::ios::binary);
+//   meta::writeArrow(std::span<const User>(users), out);
+//
+//   # pyarrow.ipc.open_file("users.arrow").read_all()
+//
+// Column types follow the member types:
+//   int, int64_t, ...     Int of the same width
+//   BoundedInt<Lo, Hi>    Int of the narrowest width holding [Lo, Hi]
+//   double / float        FloatingPoint
+//   bool                  Bool (bit-packed)
+//   strings, BoundedString Utf8 (int32 offsets + character data)
+//   EnumMapping enums     dictionary of the mapped names, int8/16/32 indices
+//                         (mappings with forEach, e.g. EnumTraitsAuto)
+//   nested structs        Struct with one child per field
+//   other enums and YamlTraits types  Utf8 of their toString text
+//
+// Columns are filled straight from the span, field by field, into the
+// record batch body; there are no per-row intermediate objects (except
+// for the toString fallback). Rows are written in batches of batchRows,
+// so memory stays at one batch body however many records there are.
+//
+// The flatbuffer metadata (Schema, RecordBatch, DictionaryBatch, Footer) is
+// encoded by hand below, so no Arrow or flatbuffers library is needed.
+//
+
+struct ArrowOptions {
+    size_t batchRows = 64 * 1024;
+};
+
+namespace detail {
+
+static_assert(std::endian::native == std::endian::little, "Arrow export writes host byte order");
+
+// ============================================================================
+// FLATBUFFER BUILDER - just enough for Arrow's metadata
+// ============================================================================
+
+// Builds back to front, as flatbuffers are meant to be: children first,
+// then the tables that point forward at them. A Ref is the distance of an
+// object from the end of the buffer.
+class FlatBuilder {
+public:
+    using Ref = uint32_t;
+
+    size_t size() const { return buf_.size() - head_; }
+
+    template<typename S>
+    void push(S value) {
+        pushBytes(&value, sizeof(S));
+    }
+
+    void pushBytes(const void* data, size_t bytes) {
+        reserve(bytes);
+        head_ -= bytes;
+        if (bytes) std::memcpy(buf_.data() + head_, data, bytes);
+    }
+
+    // Pads so that after `extra` more bytes the position is aligned
+    void align(size_t alignment, size_t extra = 0) {
+        while ((size() + extra) % alignment) push<uint8_t>(0);
+    }
+
+    Ref string(std::string_view text) {
+        align(4, text.size() + 1);
+        push<uint8_t>(0);
+        pushBytes(text.data(), text.size());
+        push(static_cast<uint32_t>(text.size()));
+        return static_cast<Ref>(size());
+    }
+
+    Ref vector(std::span<const Ref> refs) {
+        align(4, refs.size() * 4);
+        for (size_t i = refs.size(); i-- > 0;) push(offsetTo(refs[i]));
+        push(static_cast<uint32_t>(refs.size()));
+        return static_cast<Ref>(size());
+    }
+
+    template<typename S>
+    Ref structs(std::span<const S> items) {
+        align(8, items.size_bytes());
+        pushBytes(items.data(), items.size_bytes());
+        push(static_cast<uint32_t>(items.size()));
+        return static_cast<Ref>(size());
+    }
+
+    void startTable() {
+        fields_.clear();
+        tableEnd_ = size();
+    }
+
+    template<typename S>
+    void add(uint16_t slot, S value) {
+        align(sizeof(S));
+        push(value);
+        fields_.push_back({slot, size()});
+    }
+
+    void addRef(uint16_t slot, Ref ref) {
+        align(4);
+        push(offsetTo(ref));
+        fields_.push_back({slot, size()});
+    }
+
+    Ref endTable() {
+        align(4);
+        push<int32_t>(0);  // offset to the vtable, patched below
+        auto table = static_cast<Ref>(size());
+
+        uint16_t slots = 0;
+        for (const auto& field : fields_) slots = std::max<uint16_t>(slots, field.slot + 1);
+        for (size_t slot = slots; slot-- > 0;) {
+            uint16_t offset = 0;
+            for (const auto& field : fields_) {
+                if (field.slot == slot) offset = static_cast<uint16_t>(table - field.at);
+            }
+            push(offset);
+        }
+        push(static_cast<uint16_t>(table - tableEnd_));
+        push(static_cast<uint16_t>(4 + 2 * slots));
+
+        auto vtableDistance = static_cast<int32_t>(size() - table);
+        std::memcpy(buf_.data() + buf_.size() - table, &vtableDistance, 4);
+        return table;
+    }
+
+    std::vector<uint8_t> finish(Ref root) {
+        align(8, 4);
+        push(offsetTo(root));
+        return std::vector<uint8_t>(buf_.begin() + static_cast<std::ptrdiff_t>(head_), buf_.end());
+    }
+
+private:
+    struct FieldAt {
+        uint16_t slot;
+        size_t at;
+    };
+
+    std::vector<uint8_t> buf_;
+    size_t head_ = 0;
+    std::vector<FieldAt> fields_;
+    size_t tableEnd_ = 0;
+
+    // uoffset stored at the next 4 bytes, pointing at ref
+    uint32_t offsetTo(Ref ref) const { return static_cast<uint32_t>(size() + 4 - ref); }
+
+    void reserve(size_t bytes) {
+        if (head_ >= bytes) return;
+        size_t used = size();
+        size_t capacity = std::max(buf_.size() * 2, used + bytes + 256);
+        std::vector<uint8_t> grown(capacity);
+        if (used) std::memcpy(grown.data() + capacity - used, buf_.data() + head_, used);
+        buf_ = std::move(grown);
+        head_ = capacity - used;
+    }
+};
+
+using FlatRef = FlatBuilder::Ref;
+
+// ============================================================================
+// ARROW METADATA
+// ============================================================================
+
+// Union tags from Arrow's Schema.fbs / Message.fbs
+enum : uint8_t { kArrowInt = 2, kArrowFloat = 3, kArrowUtf8 = 5, kArrowBool = 6, kArrowStruct = 13 };
+enum : uint8_t { kArrowSchemaMessage = 1, kArrowDictionaryMessage = 2, kArrowRecordBatchMessage = 3 };
+constexpr int16_t kArrowMetadataV5 = 4;
+
+struct ArrowFieldNode {
+    int64_t length;
+    int64_t nullCount;
+};
+
+struct ArrowBuffer {
+    int64_t offset;
+    int64_t length;
+};
+
+struct ArrowBlock {
+    int64_t offset;
+    int32_t metaDataLength;
+    int32_t padding = 0;
+    int64_t bodyLength;
+};
+
+inline FlatRef arrowIntType(FlatBuilder& b, int bitWidth, bool isSigned) {
+    b.startTable();
+    b.add<int32_t>(0, bitWidth);
+    b.add<uint8_t>(1, isSigned);
+    return b.endTable();
+}
+
+inline FlatRef arrowEmptyTable(FlatBuilder& b) {
+    b.startTable();
+    return b.endTable();
+}
+
+inline FlatRef arrowField(FlatBuilder& b, std::string_view name, bool nullable, uint8_t typeId, FlatRef type,
+                          std::span<const FlatRef> children = {}, FlatRef dictionary = 0) {
+    FlatRef nameRef = b.string(name);
+    FlatRef childrenRef = b.vector(children);
+    b.startTable();
+    b.addRef(0, nameRef);
+    b.add<uint8_t>(1, nullable);
+    b.add<uint8_t>(2, typeId);
+    b.addRef(3, type);
+    if (dictionary) b.addRef(4, dictionary);
+    b.addRef(5, childrenRef);
+    return b.endTable();
+}
+
+// A record batch body: buffers packed back to back, each padded to 8 bytes
+struct ArrowBody {
+    std::string data;
+    std::vector<ArrowFieldNode> nodes;
+    std::vector<ArrowBuffer> buffers;
+
+    void clear() {
+        data.clear();
+        nodes.clear();
+        buffers.clear();
+    }
+
+    // Zero-filled buffer of `bytes`; returns where it starts in data
+    size_t buffer(size_t bytes) {
+        size_t at = data.size();
+        buffers.push_back({static_cast<int64_t>(at), static_cast<int64_t>(bytes)});
+        data.resize(at + ((bytes + 7) & ~size_t{7}), '\0');
+        return at;
+    }
+
+    // Absent validity bitmap: no nulls
+    void noValidity() { buffers.push_back({static_cast<int64_t>(data.size()), 0}); }
+
+    template<typename V>
+    void store(size_t at, size_t index, V value) {
+        std::memcpy(data.data() + at + index * sizeof(V), &value, sizeof(V));
+    }
+};
+
+// Enum dictionaries found while building the schema, written before the
+// first record batch
+struct ArrowSchemaContext {
+    struct Dictionary {
+        int64_t id;
+        std::function<size_t(ArrowBody&)> write;  // returns the entry count
+    };
+
+    std::vector<Dictionary> dictionaries;
+};
+
+// Utf8 column from any per-row text source, in one pass: the offsets buffer
+// is sized up front, the characters are appended behind it
+template<typename Row, typename Text>
+void writeUtf8Column(ArrowBody& body, std::span<const Row> rows, Text text) {
+    body.nodes.push_back({static_cast<int64_t>(rows.size()), 0});
+    body.noValidity();
+    size_t offsets = body.buffer((rows.size() + 1) * sizeof(int32_t));
+    size_t start = body.data.size();
+    for (size_t i = 0; i < rows.size(); i++) {
+        body.data.append(text(rows[i]));
+        size_t length = body.data.size() - start;
+        if (length > INT32_MAX) {
+            throw std::runtime_error("writeArrow: string column over 2 GiB in one batch; lower batchRows");
+        }
+        body.store(offsets, i + 1, static_cast<int32_t>(length));
+    }
+    size_t bytes = body.data.size() - start;
+    body.buffers.push_back({static_cast<int64_t>(start), static_cast<int64_t>(bytes)});
+    body.data.resize(start + ((bytes + 7) & ~size_t{7}), '\0');
+}
+
+template<typename V, typename Row, typename Get>
+void writePrimitiveColumn(ArrowBody& body, std::span<const Row> rows, Get get) {
+    body.nodes.push_back({static_cast<int64_t>(rows.size()), 0});
+    body.noValidity();
+    size_t at = body.buffer(rows.size() * sizeof(V));
+    for (size_t i = 0; i < rows.size(); i++) body.store(at, i, static_cast<V>(get(rows[i])));
+}
+
+// ============================================================================
+// ARROW TRAITS - column type per member type
+// ============================================================================
+
+// field() adds the schema Field; write() appends the column's nodes and
+// buffers for a batch of rows, reading each value through get(row)
+template<typename M>
+struct ArrowTraits;
+
+template<typename M>
+concept ArrowBoundedInt = requires(const M& v) {
+    M::min;
+    M::max;
+    M::encoding;
+    { v.value() } -> std::same_as<int>;
+};
+
+template<typename M>
+concept ArrowText = std::convertible_to<const M&, std::string_view> || requires(const M& v) {
+    { v.val } -> std::convertible_to<std::string_view>;
+};
+
+template<typename M>
+std::string_view arrowText(const M& value) {
+    if constexpr (std::convertible_to<const M&, std::string_view>)
+        return value;
+    else
+        return value.val;
+}
+
+template<typename M>
+    requires std::integral<M> && (!std::same_as<M, bool>)
+struct ArrowTraits<M> {
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext&) {
+        return arrowField(b, name, false, kArrowInt, arrowIntType(b, sizeof(M) * 8, std::is_signed_v<M>));
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        writePrimitiveColumn<M>(body, rows, get);
+    }
+};
+
+template<ArrowBoundedInt M>
+struct ArrowTraits<M> {
+    using value_type = smallest_int_t<M::min, M::max>;
+
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext&) {
+        return arrowField(b, name, false, kArrowInt,
+                          arrowIntType(b, sizeof(value_type) * 8, std::is_signed_v<value_type>));
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        writePrimitiveColumn<value_type>(body, rows, [&](const Row& row) { return get(row).value(); });
+    }
+};
+
+template<std::floating_point M>
+struct ArrowTraits<M> {
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext&) {
+        b.startTable();
+        b.add<int16_t>(0, sizeof(M) == 4 ? 1 : 2);  // Precision SINGLE / DOUBLE
+        return arrowField(b, name, false, kArrowFloat, b.endTable());
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        writePrimitiveColumn<M>(body, rows, get);
+    }
+};
+
+template<>
+struct ArrowTraits<bool> {
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext&) {
+        return arrowField(b, name, false, kArrowBool, arrowEmptyTable(b));
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        body.nodes.push_back({static_cast<int64_t>(rows.size()), 0});
+        body.noValidity();
+        size_t at = body.buffer((rows.size() + 7) / 8);
+        for (size_t i = 0; i < rows.size(); i++) {
+            if (get(rows[i])) body.data[at + i / 8] |= static_cast<char>(1u << (i % 8));
+        }
+    }
+};
+
+template<typename M>
+    requires ArrowText<M> && (!std::is_arithmetic_v<M>)
+struct ArrowTraits<M> {
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext&) {
+        return arrowField(b, name, false, kArrowUtf8, arrowEmptyTable(b));
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        writeUtf8Column(body, rows, [&](const Row& row) { return arrowText(get(row)); });
+    }
+};
+
+// Mappings that can list their values (EnumTraitsAuto's forEach)
+template<typename M>
+concept ArrowDictionaryEnum = RegisteredEnum<M> && requires {
+    EnumMapping<M>::Type::forEach([](M) {});
+};
+
+// Dictionary of every mapped name; a value with no mapping is written as null
+template<ArrowDictionaryEnum M>
+struct ArrowTraits<M> {
+    using Traits = typename EnumMapping<M>::Type;
+
+    static const std::vector<M>& values() {
+        static const std::vector<M> all = [] {
+            std::vector<M> v;
+            Traits::forEach([&](M e) { v.push_back(e); });
+            return v;
+        }();
+        return all;
+    }
+
+    static int indexBits() { return values().size() <= INT8_MAX ? 8 : values().size() <= INT16_MAX ? 16 : 32; }
+
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext& context) {
+        auto id = static_cast<int64_t>(context.dictionaries.size());
+        context.dictionaries.push_back({id, [](ArrowBody& body) {
+            std::span<const M> all(values());
+            writeUtf8Column(body, all, [](M e) { return Traits::toString(e); });
+            return all.size();
+        }});
+
+        FlatRef indexType = arrowIntType(b, indexBits(), true);
+        b.startTable();
+        b.add<int64_t>(0, id);
+        b.addRef(1, indexType);
+        b.add<uint8_t>(2, false);
+        FlatRef dictionary = b.endTable();
+        return arrowField(b, name, true, kArrowUtf8, arrowEmptyTable(b), {}, dictionary);
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        static const std::unordered_map<M, int32_t> index = [] {
+            std::unordered_map<M, int32_t> m;
+            for (size_t i = 0; i < values().size(); i++) m.emplace(values()[i], static_cast<int32_t>(i));
+            return m;
+        }();
+
+        const size_t n = rows.size();
+        body.nodes.push_back({static_cast<int64_t>(n), 0});
+        size_t validity = body.buffer((n + 7) / 8);
+        const int bits = indexBits();
+        size_t at = body.buffer(n * static_cast<size_t>(bits / 8));
+        int64_t nulls = 0;
+        for (size_t i = 0; i < n; i++) {
+            auto it = index.find(get(rows[i]));
+            if (it == index.end()) {
+                nulls++;
+                continue;
+            }
+            body.data[validity + i / 8] |= static_cast<char>(1u << (i % 8));
+            if (bits == 8) {
+                body.store(at, i, static_cast<int8_t>(it->second));
+            } else if (bits == 16) {
+                body.store(at, i, static_cast<int16_t>(it->second));
+            } else {
+                body.store(at, i, it->second);
+            }
+        }
+        body.nodes.back().nullCount = nulls;
+    }
+};
+
+template<NestedFields M>
+struct ArrowTraits<M> {
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext& context) {
+        std::vector<FlatRef> children;
+        std::apply(
+            [&](auto&... fields) {
+                (children.push_back(ArrowTraits<typename std::remove_cvref_t<decltype(fields)>::type>::field(
+                     b, fields.fieldName, context)),
+                 ...);
+            },
+            M::fields);
+        return arrowField(b, name, false, kArrowStruct, arrowEmptyTable(b), children);
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        body.nodes.push_back({static_cast<int64_t>(rows.size()), 0});
+        body.noValidity();
+        std::apply(
+            [&](auto&... fields) {
+                (ArrowTraits<typename std::remove_cvref_t<decltype(fields)>::type>::write(
+                     body, rows, [&](const Row& row) -> const auto& { return get(row).*fields.memberPtr; }),
+                 ...);
+            },
+            M::fields);
+    }
+};
+
+// Anything else with YamlTraits, and enums whose mapping cannot list its
+// values: their toString text
+template<typename M>
+    requires(HasYamlTraits<M> && !ArrowText<M> && !ArrowBoundedInt<M> && !std::is_arithmetic_v<M>) ||
+            (IsEnum<M> && !ArrowDictionaryEnum<M>)
+struct ArrowTraits<M> {
+    static FlatRef field(FlatBuilder& b, std::string_view name, ArrowSchemaContext&) {
+        return arrowField(b, name, false, kArrowUtf8, arrowEmptyTable(b));
+    }
+
+    template<typename Row, typename Get>
+    static void write(ArrowBody& body, std::span<const Row> rows, Get get) {
+        writeUtf8Column(body, rows, [&](const Row& row) { return dispatchToString(get(row)); });
+    }
+};
+
+// ============================================================================
+// FILE LAYOUT
+// ============================================================================
+
+template<HasFields T>
+FlatRef arrowSchema(FlatBuilder& b, ArrowSchemaContext& context) {
+    std::vector<FlatRef> fields;
+    std::apply(
+        [&](auto&... field) {
+            (fields.push_back(ArrowTraits<typename std::remove_cvref_t<decltype(field)>::type>::field(
+                 b, field.fieldName, context)),
+             ...);
+        },
+        T::fields);
+    FlatRef fieldsRef = b.vector(fields);
+    b.startTable();
+    b.add<int16_t>(0, 0);  // little endian
+    b.addRef(1, fieldsRef);
+    return b.endTable();
+}
+
+inline FlatRef arrowRecordBatch(FlatBuilder& b, int64_t length, const ArrowBody& body) {
+    FlatRef nodes = b.structs(std::span<const ArrowFieldNode>(body.nodes));
+    FlatRef buffers = b.structs(std::span<const ArrowBuffer>(body.buffers));
+    b.startTable();
+    b.add<int64_t>(0, length);
+    b.addRef(1, nodes);
+    b.addRef(2, buffers);
+    return b.endTable();
+}
+
+class ArrowFileWriter {
+public:
+    explicit ArrowFileWriter(std::ostream& out) : out_(out) { write("ARROW1\0\0", 8); }
+
+    // Encapsulated message: 0xFFFFFFFF, metadata length, Message flatbuffer
+    // padded to 8, then the body. header() builds the header table.
+    template<typename Header>
+    ArrowBlock message(uint8_t headerType, Header header, const std::string& body) {
+        FlatBuilder b;
+        FlatRef headerRef = header(b);
+        b.startTable();
+        b.add<int16_t>(0, kArrowMetadataV5);
+        b.add<uint8_t>(1, headerType);
+        b.addRef(2, headerRef);
+        b.add<int64_t>(3, static_cast<int64_t>(body.size()));
+        std::vector<uint8_t> metadata = b.finish(b.endTable());
+
+        ArrowBlock block{static_cast<int64_t>(position_), 0, 0, static_cast<int64_t>(body.size())};
+        auto padded = static_cast<int32_t>((metadata.size() + 7) & ~size_t{7});
+        block.metaDataLength = padded + 8;
+        write("\xff\xff\xff\xff", 4);
+        write(&padded, 4);
+        write(metadata.data(), metadata.size());
+        write("\0\0\0\0\0\0\0", static_cast<size_t>(padded) - metadata.size());
+        write(body.data(), body.size());
+        return block;
+    }
+
+    template<typename Schema>
+    void finish(Schema schema, std::span<const ArrowBlock> dictionaries, std::span<const ArrowBlock> batches) {
+        write("\xff\xff\xff\xff\0\0\0\0", 8);  // end of stream
+
+        FlatBuilder b;
+        FlatRef schemaRef = schema(b);
+        FlatRef dictionariesRef = b.structs(dictionaries);
+        FlatRef batchesRef = b.structs(batches);
+        b.startTable();
+        b.add<int16_t>(0, kArrowMetadataV5);
+        b.addRef(1, schemaRef);
+        b.addRef(2, dictionariesRef);
+        b.addRef(3, batchesRef);
+        std::vector<uint8_t> footer = b.finish(b.endTable());
+
+        auto length = static_cast<int32_t>(footer.size());
+        write(footer.data(), footer.size());
+        write(&length, 4);
+        write("ARROW1", 6);
+        out_.flush();
+        if (!out_) throw std::runtime_error("writeArrow: write failed");
+    }
+
+private:
+    std::ostream& out_;
+    size_t position_ = 0;
+
+    void write(const void* data, size_t bytes) {
+        out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        if (!out_) throw std::runtime_error("writeArrow: write failed");
+        position_ += bytes;
+    }
+};
+
+}  // namespace detail
+
+// Arrow IPC file (the "Feather v2" format) with one column per field of T
+template<HasFields T>
+void writeArrow(std::span<const T> records, std::ostream& out, ArrowOptions options = {}) {
+    const size_t batchRows = std::max<size_t>(options.batchRows, 1);
+    detail::ArrowFileWriter file(out);
+    detail::ArrowBody body;
+
+    detail::ArrowSchemaContext context;
+    file.message(detail::kArrowSchemaMessage, [&](detail::FlatBuilder& b) { return detail::arrowSchema<T>(b, context); },
+                 body.data);
+
+    std::vector<detail::ArrowBlock> dictionaries;
+    for (const auto& dictionary : context.dictionaries) {
+        body.clear();
+        auto length = static_cast<int64_t>(dictionary.write(body));
+        dictionaries.push_back(file.message(
+            detail::kArrowDictionaryMessage,
+            [&](detail::FlatBuilder& b) {
+                detail::FlatRef data = detail::arrowRecordBatch(b, length, body);
+                b.startTable();
+                b.add<int64_t>(0, dictionary.id);
+                b.addRef(1, data);
+                return b.endTable();
+            },
+            body.data));
+    }
+
+    std::vector<detail::ArrowBlock> batches;
+    for (size_t start = 0; start < records.size(); start += batchRows) {
+        auto rows = records.subspan(start, std::min(batchRows, records.size() - start));
+        body.clear();
+        std::apply(
+            [&](auto&... field) {
+                (detail::ArrowTraits<typename std::remove_cvref_t<decltype(field)>::type>::write(
+                     body, rows, [&](const T& row) -> const auto& { return row.*field.memberPtr; }),
+                 ...);
+            },
+            T::fields);
+        batches.push_back(file.message(
+            detail::kArrowRecordBatchMessage,
+            [&](detail::FlatBuilder& b) { return detail::arrowRecordBatch(b, static_cast<int64_t>(rows.size()), body); },
+            body.data));
+    }
+
+    file.finish(
+        [](detail::FlatBuilder& b) {
+            detail::ArrowSchemaContext unused;
+            return detail::arrowSchema<T>(b, unused);
+        },
+        dictionaries, batches);
+}
+
+template<HasFields T>
+void writeArrow(const std::vector<T>& records, std::ostream& out, ArrowOptions options = {}) {
+    writeArrow(std::span<const T>(records), out, options);
+}
+
+}  // namespace meta
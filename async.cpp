@@ -0,0 +1,86 @@
+#include "meta.h"
+#include "bounded.h"
+#include "async.h"
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <iostream>
+
+// ============================================================================
+// CONFIG TYPE
+// ============================================================================
+
+struct ServiceConfig {
+    std::string name;
+    meta::BoundedInt<1, 65535> port;
+    int workers = 4;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&ServiceConfig::name>("name", "Service name", meta::RequiredField),
+        meta::Field<&ServiceConfig::port>("port", "Listen port", meta::RequiredField),
+        meta::Field<&ServiceConfig::workers>("workers", "Worker threads", meta::OptionalField)
+    };
+};
+
+// Smallest coroutine type that can co_await: starts eagerly, signals when done
+struct Task {
+    struct promise_type {
+        std::promise<void> finished;
+
+        Task get_return_object() { return Task{finished.get_future()}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { finished.set_value(); }
+        void unhandled_exception() { finished.set_exception(std::current_exception()); }
+    };
+
+    std::future<void> done;
+};
+
+Task reload(std::string path) {
+    auto [config, result] = co_await meta::loadConfig<ServiceConfig>(path);
+    if (config) {
+        std::cout << "✓ " << config->name << " on port " << config->port.value()
+                  << " with " << config->workers << " workers\n";
+    } else {
+        for (const auto& [field, msg] : result.errors) {
+            std::cout << "✗ " << (field.empty() ? "<root>" : field) << ": " << msg << "\n";
+        }
+    }
+}
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Async Config Loading ===\n\n";
+
+#if META_HAS_IO_URING
+    std::cout << "reads via " << (meta::IoUring::instance() ? "io_uring" : "thread pool") << "\n\n";
+#else
+    std::cout << "reads via thread pool\n\n";
+#endif
+
+    const std::string good = "async_demo_good.yaml";
+    const std::string bad = "async_demo_bad.yaml";
+    std::ofstream(good) << "name: billing\nport: 8443\nworkers: 16\n";
+    std::ofstream(bad) << "name: billing\nport: 70000\n";
+
+    // ========================================
+    // Several loads in flight at once
+    // ========================================
+    Task a = reload(good);
+    Task b = reload(bad);
+    Task c = reload("async_demo_missing.yaml");
+
+    a.done.get();
+    b.done.get();
+    c.done.get();
+
+    std::remove(good.c_str());
+    std::remove(bad.c_str());
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
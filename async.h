@@ -0,0 +1,462 @@
+#pragma once
+
+#include "meta.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ThreadSanitizer cannot see the ordering the kernel provides between a
+// submission and its completion, so TSan builds use the thread-pool path
+#if defined(__linux__) && __has_include(<linux/io_uring.h>) && !defined(__SANITIZE_THREAD__)
+#define META_HAS_IO_URING 1
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace meta {
+
+// ============================================================================
+// ASYNC LOADING - co_await a config without blocking the caller's thread
+// ============================================================================
+//
+//   Task reload() {
+//       auto [config, result] = co_await meta::loadConfig<ServiceConfig>("/etc/svc.yaml");
+//       ...
+//   }
+//
+// The file is read through io_uring where the kernel offers it (raw
+// syscalls, no liburing needed), otherwise on a ThreadPool worker. Parsing
+// and validation always run on a ThreadPool worker. The awaiting coroutine
+// is resumed on that worker, or handed to `resumeOn` (e.g. a function that
+// posts the handle back to the event loop) when one is given.
+//
+
+// ============================================================================
+// THREAD POOL
+// ============================================================================
+
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t threads = std::max(2u, std::thread::hardware_concurrency())) {
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            workers_.emplace_back([this] { run(); });
+        }
+    }
+
+    // Finishes the queued tasks, then joins
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        ready_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void post(std::function<void()> task) {
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        ready_.notify_one();
+    }
+
+    size_t size() const { return workers_.size(); }
+
+    // Pool used by loadConfig when none is given
+    static ThreadPool& shared() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> workers_;
+    bool stopping_ = false;
+
+    void run() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex_);
+                ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+#if META_HAS_IO_URING
+
+// ============================================================================
+// IO_URING - one shared ring, completions dispatched from a reaper thread
+// ============================================================================
+
+class IoUring {
+public:
+    // Embedded in whatever issued the operation; called on the reaper
+    // thread, so it should only queue the next step
+    struct Completion {
+        void (*callback)(Completion* self, int result) = nullptr;
+    };
+
+    // nullptr when the kernel (or a seccomp policy) refuses io_uring
+    static IoUring* instance() {
+        static IoUring ring;
+        return ring.fd_ >= 0 ? &ring : nullptr;
+    }
+
+    // Queues one operation; its result (res, i.e. -errno on failure) is
+    // passed to completion->callback. Returns false only when the kernel
+    // refused the entry: it is then off the ring and the callback never runs.
+    bool submit(io_uring_sqe sqe, Completion* completion) {
+        sqe.user_data = reinterpret_cast<uint64_t>(completion);
+
+        // Without SQPOLL the kernel consumes entries only inside the
+        // io_uring_enter below, and each call waits for its own entry to be
+        // consumed, so the ring is empty here and an entry the kernel has
+        // not taken can still be withdrawn
+        std::lock_guard lock(submitMutex_);
+        unsigned tail = *sqTail_;
+        unsigned index = tail & sqMask_;
+        sqes_[index] = sqe;
+        sqArray_[index] = index;
+        std::atomic_ref(*sqTail_).store(tail + 1, std::memory_order_release);
+
+        for (;;) {
+            long submitted = syscall(__NR_io_uring_enter, fd_, 1, 0, 0, nullptr, 0);
+            if (std::atomic_ref(*sqHead_).load(std::memory_order_acquire) != tail) {
+                return true;  // the kernel owns it now; a CQE will follow
+            }
+            if (submitted < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                std::atomic_ref(*sqTail_).store(tail, std::memory_order_release);
+                return false;
+            }
+        }
+    }
+
+    ~IoUring() {
+        if (fd_ < 0) return;
+        io_uring_sqe stop{};
+        stop.opcode = IORING_OP_NOP;
+        if (!submit(stop, nullptr)) {  // user_data 0 tells the reaper to exit
+            reaper_.detach();  // blocked on a ring that no longer works; keep it mapped
+            return;
+        }
+        reaper_.join();
+        unmap();
+        close(fd_);
+    }
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+private:
+    static constexpr unsigned kEntries = 64;
+
+    int fd_ = -1;
+    void* sqRing_ = MAP_FAILED;
+    void* cqRing_ = MAP_FAILED;
+    size_t sqRingSize_ = 0;
+    size_t cqRingSize_ = 0;
+    io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesSize_ = 0;
+
+    unsigned* sqHead_ = nullptr;
+    unsigned* sqTail_ = nullptr;
+    unsigned* sqArray_ = nullptr;
+    unsigned sqMask_ = 0;
+
+    unsigned* cqHead_ = nullptr;
+    unsigned* cqTail_ = nullptr;
+    io_uring_cqe* cqes_ = nullptr;
+    unsigned cqMask_ = 0;
+
+    std::mutex submitMutex_;
+    std::thread reaper_;
+
+    IoUring() {
+        io_uring_params params{};
+        fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kEntries, &params));
+        if (fd_ < 0) return;
+
+        sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMap) sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+
+        sqRing_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                       IORING_OFF_SQ_RING);
+        cqRing_ = singleMap ? sqRing_
+                            : mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                   fd_, IORING_OFF_CQ_RING);
+        sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE,
+                                                MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES));
+        if (sqRing_ == MAP_FAILED || cqRing_ == MAP_FAILED || sqes_ == MAP_FAILED) {
+            unmap();
+            close(fd_);
+            fd_ = -1;
+            return;
+        }
+
+        auto* sq = static_cast<char*>(sqRing_);
+        sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+
+        auto* cq = static_cast<char*>(cqRing_);
+        cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+
+        reaper_ = std::thread([this] { reap(); });
+    }
+
+    void unmap() {
+        if (sqes_ != MAP_FAILED) munmap(sqes_, sqesSize_);
+        if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_) munmap(cqRing_, cqRingSize_);
+        if (sqRing_ != MAP_FAILED) munmap(sqRing_, sqRingSize_);
+    }
+
+    void reap() {
+        for (;;) {
+            syscall(__NR_io_uring_enter, fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+            unsigned head = *cqHead_;
+            unsigned tail = std::atomic_ref(*cqTail_).load(std::memory_order_acquire);
+            bool stop = false;
+            for (; head != tail; head++) {
+                io_uring_cqe cqe = cqes_[head & cqMask_];
+                std::atomic_ref(*cqHead_).store(head + 1, std::memory_order_release);
+                if (cqe.user_data == 0) {
+                    stop = true;
+                } else {
+                    auto* completion = reinterpret_cast<Completion*>(cqe.user_data);
+                    completion->callback(completion, cqe.res);
+                }
+            }
+            if (stop) return;
+        }
+    }
+};
+
+#endif  // META_HAS_IO_URING
+
+// ============================================================================
+// loadConfig
+// ============================================================================
+
+namespace detail {
+
+inline std::string describeErrno(int error) {
+    return std::strerror(error);
+}
+
+// Blocking read, for the thread-pool path
+inline int readWholeFile(const std::string& path, std::string& data) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return errno != 0 ? errno : ENOENT;
+    std::ostringstream text;
+    text << in.rdbuf();
+    data = std::move(text).str();
+    return 0;
+}
+
+#if META_HAS_IO_URING
+
+// openat -> read... (until a short read of 0) -> close, each step issued
+// from the previous step's completion
+class UringFileRead : public IoUring::Completion {
+public:
+    // done(context, errno) runs on the reaper thread once the file is read
+    // or fails, and may free this object; a kernel without these opcodes
+    // reports EINVAL from the open
+    using Done = void (*)(void* context, int error);
+
+    UringFileRead(IoUring& ring, std::string path, Done done, void* context)
+        : ring_(ring), path_(std::move(path)), done_(done), context_(context) {
+        callback = &UringFileRead::onComplete;
+    }
+
+    bool start() {
+        io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_OPENAT;
+        sqe.fd = AT_FDCWD;
+        sqe.addr = reinterpret_cast<uint64_t>(path_.c_str());
+        sqe.open_flags = O_RDONLY | O_CLOEXEC;
+        return ring_.submit(sqe, this);
+    }
+
+    std::string& data() { return data_; }
+
+private:
+    static constexpr size_t kFirstRead = 64 * 1024;
+    static constexpr size_t kMaxRead = 4 * 1024 * 1024;
+
+    IoUring& ring_;
+    std::string path_;
+    Done done_;
+    void* context_;
+    std::string data_;
+    int fd_ = -1;
+    size_t offset_ = 0;
+    size_t readSize_ = kFirstRead;
+
+    static void onComplete(IoUring::Completion* self, int result) {
+        static_cast<UringFileRead*>(self)->step(result);
+    }
+
+    void step(int result) {
+        if (fd_ < 0) {
+            if (result < 0) return finish(-result);
+            fd_ = result;
+            return readNext();
+        }
+        if (result < 0) return finish(-result);
+        if (result == 0) {
+            data_.resize(offset_);
+            return finish(0);
+        }
+        offset_ += static_cast<size_t>(result);
+        readSize_ = std::min(readSize_ * 2, kMaxRead);
+        readNext();
+    }
+
+    void readNext() {
+        data_.resize(offset_ + readSize_);
+        io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd_;
+        sqe.addr = reinterpret_cast<uint64_t>(data_.data() + offset_);
+        sqe.len = static_cast<uint32_t>(readSize_);
+        sqe.off = offset_;
+        if (!ring_.submit(sqe, this)) finish(EIO);
+    }
+
+    void finish(int error) {
+        if (fd_ >= 0) close(fd_);  // closing a regular file does not block
+        fd_ = -1;
+        done_(context_, error);  // last touch of *this
+    }
+};
+
+#endif  // META_HAS_IO_URING
+
+}  // namespace detail
+
+template<HasFields T>
+class LoadConfig {
+public:
+    using result_type = std::pair<std::optional<T>, ValidationResult>;
+
+    LoadConfig(std::string path, ThreadPool& pool, std::function<void(std::coroutine_handle<>)> resumeOn)
+        : path_(std::move(path)), pool_(pool), resumeOn_(std::move(resumeOn)) {}
+
+    // Lives in the awaiting coroutine's frame while the load is in flight
+    LoadConfig(const LoadConfig&) = delete;
+    LoadConfig& operator=(const LoadConfig&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> caller) {
+        caller_ = caller;
+#if META_HAS_IO_URING
+        if (IoUring* ring = IoUring::instance()) {
+            read_.emplace(*ring, path_, &LoadConfig::onRead, this);
+            if (read_->start()) return;
+            read_.reset();
+        }
+#endif
+        pool_.post([this] {
+            std::string data;
+            int error = detail::readWholeFile(path_, data);
+            parseAndResume(error, std::move(data));
+        });
+    }
+
+    result_type await_resume() { return std::move(result_); }
+
+private:
+    std::string path_;
+    ThreadPool& pool_;
+    std::function<void(std::coroutine_handle<>)> resumeOn_;
+    std::coroutine_handle<> caller_;
+    result_type result_;
+#if META_HAS_IO_URING
+    std::optional<detail::UringFileRead> read_;
+
+    // Reaper thread: hand the text to a worker
+    static void onRead(void* context, int error) {
+        static_cast<LoadConfig*>(context)->readDone(error);
+    }
+
+    void readDone(int error) {
+        if (error == EINVAL) {
+            // openat/read opcodes missing (kernel < 5.6): read on the pool instead
+            pool_.post([this] {
+                std::string data;
+                int readError = detail::readWholeFile(path_, data);
+                parseAndResume(readError, std::move(data));
+            });
+            return;
+        }
+        pool_.post([this, error] { parseAndResume(error, std::move(read_->data())); });
+    }
+#endif
+
+    void parseAndResume(int error, std::string data) {
+        if (error != 0) {
+            result_.second.addError("", "Cannot read " + path_ + ": " + detail::describeErrno(error));
+        } else {
+            try {
+                result_ = fromYamlWithValidation<T>(YAML::Load(data));
+            } catch (const std::exception& e) {
+                result_.second.addError("", std::string("Parse error: ") + e.what());
+            }
+        }
+
+        if (resumeOn_) {
+            resumeOn_(caller_);
+        } else {
+            caller_.resume();
+        }
+    }
+};
+
+// Awaitable yielding fromYamlWithValidation<T>'s (optional<T>, ValidationResult)
+template<HasFields T>
+LoadConfig<T> loadConfig(std::string path, std::function<void(std::coroutine_handle<>)> resumeOn = {},
+                         ThreadPool& pool = ThreadPool::shared()) {
+    return LoadConfig<T>(std::move(path), pool, std::move(resumeOn));
+}
+
+}  // namespace meta
@@ -0,0 +1,81 @@
+#include "meta.h"
+#include "bounded.h"
+#include "batch.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// ============================================================================
+// USER STRUCT WITH BOUNDED TYPES
+// ============================================================================
+
+struct Person {
+    meta::BoundedString<1, 32> name;
+    meta::BoundedInt<0, 150> age;
+    meta::BoundedInt<0, 100> score;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Person::name>("name", "Person's name", meta::RequiredField),
+        meta::Field<&Person::age>("age", "Person's age (0-150)", meta::RequiredField),
+        meta::Field<&Person::score>("score", "Person's score (0-100)", meta::RequiredField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Batch Validation ===\n\n";
+
+    // Records that bypassed parsing (e.g. loaded from a binary cache)
+    std::vector<Person> people(1000000);
+    for (size_t i = 0; i < people.size(); i++) {
+        people[i].name = std::string(1 + i % 20, 'a');
+        people[i].age = static_cast<int>(i % 150);
+        people[i].score = static_cast<int>(i % 101);
+    }
+    people[12].age = 200;
+    people[777777].age = 151;
+    people[42].name = std::string();
+
+    // ========================================
+    // One field across all records
+    // ========================================
+    std::cout << "--- validateBatch<&Person::age> ---\n";
+
+    auto start = std::chrono::steady_clock::now();
+    auto badAges = meta::validateBatch<&Person::age>(people);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    std::cout << "✓ Checked " << people.size() << " ages in " << elapsed.count() << " us, "
+              << badAges.count() << " out of range:\n";
+    badAges.forEach([&](size_t i) {
+        std::cout << "  ✗ row " << i << ": age " << people[i].age.value() << "\n";
+    });
+
+    auto badNames = meta::validateBatch<&Person::name>(people);
+    badNames.forEach([&](size_t i) {
+        std::cout << "  ✗ row " << i << ": name length " << people[i].name.val.length() << "\n";
+    });
+
+    // ========================================
+    // Column already laid out contiguously
+    // ========================================
+    std::cout << "\n--- validateColumn ---\n";
+
+    std::vector<meta::BoundedInt<0, 100>> scores{10, 99, 101, 50};
+    auto badScores = meta::validateColumn(scores);
+    std::cout << (badScores.any() ? "✗" : "✓") << " " << badScores.count()
+              << " of " << scores.size() << " scores out of range\n";
+
+    std::vector<int32_t> ports{80, 443, 0, 8080, 70000};
+    auto badPorts = meta::validateColumn<1, 65535>(ports);
+    badPorts.forEach([&](size_t i) {
+        std::cout << "  ✗ port " << ports[i] << " at index " << i << "\n";
+    });
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
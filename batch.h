@@ -0,0 +1,193 @@
+#pragma once
+#include "meta.h"
+#include "bounded.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace meta {
+
+// ============================================================================
+// BATCH VALIDATION - range checks over whole columns
+// ============================================================================
+//
+// Re-validating records that are already in memory (loaded from a cache,
+// built by hand) one isValid() at a time costs a branch per element.
+// These functions gather the checked quantity (BoundedInt value,
+// BoundedString length) 64 elements at a time into an int32 block and
+// range-check the block with vector compares:
+//
+//   AVX-512  16 lanes   (-mavx512f)
+//   AVX2      8 lanes   (-mavx2)
+//   SSE2      4 lanes   (x86-64 baseline)
+//   scalar    otherwise
+//
+// The result is a FailureMask: one bit per element, set where the element
+// is out of bounds.
+//
+// Usage:
+//   std::vector<Person> people = ...;
+//   auto bad = meta::validateBatch<&Person::age>(people);
+//   bad.forEach([&](size_t i) { std::cout << "row " << i << "\n"; });
+//
+//   auto bad2 = meta::validateColumn(ages);  // std::vector<BoundedInt<0, 150>>
+//
+
+class FailureMask {
+public:
+    explicit FailureMask(size_t size) : words_((size + 63) / 64, 0), size_(size) {}
+
+    size_t size() const { return size_; }
+    bool test(size_t index) const { return (words_[index / 64] >> (index % 64)) & 1; }
+
+    size_t count() const {
+        size_t total = 0;
+        for (uint64_t w : words_) total += static_cast<size_t>(std::popcount(w));
+        return total;
+    }
+
+    bool any() const {
+        return std::any_of(words_.begin(), words_.end(), [](uint64_t w) { return w != 0; });
+    }
+    bool none() const { return !any(); }
+
+    // Calls f(index) for every failing element, in order
+    template<typename Func>
+    void forEach(Func f) const {
+        for (size_t w = 0; w < words_.size(); w++) {
+            for (uint64_t bits = words_[w]; bits != 0; bits &= bits - 1) {
+                f(w * 64 + static_cast<size_t>(std::countr_zero(bits)));
+            }
+        }
+    }
+
+    std::span<const uint64_t> words() const { return words_; }
+    std::span<uint64_t> words() { return words_; }
+
+private:
+    std::vector<uint64_t> words_;
+    size_t size_;
+};
+
+namespace detail {
+
+// Bit i set where values[i] is outside [lo, hi]; n <= 64
+inline uint64_t rangeMask(const int32_t* values, size_t n, int32_t lo, int32_t hi) {
+    uint64_t mask = 0;
+    size_t i = 0;
+#if defined(__AVX512F__)
+    const __m512i vlo = _mm512_set1_epi32(lo);
+    const __m512i vhi = _mm512_set1_epi32(hi);
+    for (; i + 16 <= n; i += 16) {
+        __m512i v = _mm512_loadu_si512(values + i);
+        __mmask16 bad = _mm512_cmplt_epi32_mask(v, vlo) | _mm512_cmpgt_epi32_mask(v, vhi);
+        mask |= uint64_t{bad} << i;
+    }
+#elif defined(__AVX2__)
+    const __m256i vlo = _mm256_set1_epi32(lo);
+    const __m256i vhi = _mm256_set1_epi32(hi);
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        __m256i bad = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, v), _mm256_cmpgt_epi32(v, vhi));
+        mask |= uint64_t(static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(bad)))) << i;
+    }
+#elif defined(__SSE2__)
+    const __m128i vlo = _mm_set1_epi32(lo);
+    const __m128i vhi = _mm_set1_epi32(hi);
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        __m128i bad = _mm_or_si128(_mm_cmplt_epi32(v, vlo), _mm_cmpgt_epi32(v, vhi));
+        mask |= uint64_t(static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(bad)))) << i;
+    }
+#endif
+    for (; i < n; i++) {
+        mask |= uint64_t(values[i] < lo || values[i] > hi) << i;
+    }
+    return mask;
+}
+
+constexpr int32_t clampToInt32(size_t n) {
+    return static_cast<int32_t>(std::min<size_t>(n, std::numeric_limits<int32_t>::max()));
+}
+
+// What to gather from a column element and the bounds to check it against
+template<typename M>
+struct BatchBounds;
+
+template<int Min, int Max, IntEncoding Encoding>
+struct BatchBounds<BoundedInt<Min, Max, Encoding>> {
+    static constexpr int32_t lo = Min;
+    static constexpr int32_t hi = Max;
+    static int32_t key(const BoundedInt<Min, Max, Encoding>& v) { return v.value(); }
+};
+
+template<size_t MinLen, size_t MaxLen, typename String>
+struct BatchBounds<BoundedString<MinLen, MaxLen, String>> {
+    static constexpr int32_t lo = clampToInt32(MinLen);
+    static constexpr int32_t hi = clampToInt32(MaxLen);
+    static int32_t key(const BoundedString<MinLen, MaxLen, String>& v) { return clampToInt32(v.val.length()); }
+};
+
+template<typename M>
+concept BatchValidatable = requires { BatchBounds<M>::lo; };
+
+// Gathers project(i) for i in [0, n) in blocks of 64 and range-checks each block
+template<typename M, typename Project>
+FailureMask validateGathered(size_t n, Project project) {
+    FailureMask failures(n);
+    auto words = failures.words();
+    alignas(64) int32_t block[64];
+    for (size_t base = 0; base < n; base += 64) {
+        size_t count = std::min<size_t>(64, n - base);
+        for (size_t j = 0; j < count; j++) {
+            block[j] = BatchBounds<M>::key(project(base + j));
+        }
+        words[base / 64] = rangeMask(block, count, BatchBounds<M>::lo, BatchBounds<M>::hi);
+    }
+    return failures;
+}
+
+}  // namespace detail
+
+// One field across a span of records
+template<auto MemberPtr>
+FailureMask validateBatch(std::span<const typename member_pointer_traits<decltype(MemberPtr)>::class_type> records) {
+    using M = typename member_pointer_traits<decltype(MemberPtr)>::type;
+    static_assert(detail::BatchValidatable<M>, "validateBatch supports BoundedInt and BoundedString fields");
+    return detail::validateGathered<M>(records.size(), [&](size_t i) -> const M& { return records[i].*MemberPtr; });
+}
+
+// A column that is already contiguous (e.g. std::vector<BoundedInt<0, 150>>)
+template<std::ranges::random_access_range Column>
+    requires detail::BatchValidatable<std::ranges::range_value_t<Column>>
+FailureMask validateColumn(const Column& column) {
+    using M = std::ranges::range_value_t<Column>;
+    auto first = std::ranges::begin(column);
+    return detail::validateGathered<M>(static_cast<size_t>(std::ranges::size(column)),
+                                       [&](size_t i) -> const M& { return first[i]; });
+}
+
+// Raw ints checked against [Min, Max]; no gather step
+template<int Min, int Max>
+FailureMask validateColumn(std::span<const int32_t> values) {
+    FailureMask failures(values.size());
+    auto words = failures.words();
+    for (size_t base = 0; base < values.size(); base += 64) {
+        size_t count = std::min<size_t>(64, values.size() - base);
+        words[base / 64] = detail::rangeMask(values.data() + base, count, Min, Max);
+    }
+    return failures;
+}
+
+}  // namespace meta
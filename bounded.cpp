@@ -33,6 +33,57 @@ struct AppConfig {
     };
 };
 
+// Same shape as AppConfig, but every string lives in a caller-supplied arena
+struct ArenaConfig {
+  meta::pmr::BoundedString<1, 255> hostname;
+  meta::BoundedInt<1, 65535> port;
+  std::pmr::map<std::pmr::string, std::pmr::string> settings;
+  std::pmr::string region = "eu-west-1 (default region)";
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&ArenaConfig::hostname>("hostname", "Server hostname", meta::RequiredField),
+        meta::Field<&ArenaConfig::port>("port", "Server port", meta::RequiredField),
+        meta::Field<&ArenaConfig::settings>("settings", "Settings map", meta::RequiredField),
+        meta::Field<&ArenaConfig::region>("region", "Deployment region", meta::OptionalField)
+    };
+};
+
+// Up to three backup hosts, held inline in the struct
+struct ClusterConfig {
+  meta::BoundedString<1, 255> primary;
+  meta::BoundedVector<meta::BoundedString<1, 255>, 0, 3> backups;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&ClusterConfig::primary>("primary", "Primary host", meta::RequiredField),
+        meta::Field<&ClusterConfig::backups>("backups", "Backup hosts (max 3)", meta::OptionalField)
+    };
+};
+
+// Narrow scalars: each BoundedInt picks the smallest type for its range
+struct Reading {
+  meta::BoundedInt<0, 100> humidity;                                 // uint8_t
+  meta::BoundedInt<-40, 85> celsius;                                 // int8_t
+  meta::BoundedInt<950, 1150, meta::IntEncoding::Offset> pressure;   // uint8_t, value - 949
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Reading::humidity>("humidity", "Relative humidity %", meta::RequiredField),
+        meta::Field<&Reading::celsius>("celsius", "Temperature", meta::RequiredField),
+        meta::Field<&Reading::pressure>("pressure", "Pressure (hPa)", meta::RequiredField)
+    };
+};
+
+// Defaults built with of() are checked by the compiler
+struct ServerDefaults {
+  meta::BoundedString<1, 64> host = meta::BoundedString<1, 64>::of("localhost");
+  meta::BoundedInt<1, 65535> port = meta::BoundedInt<1, 65535>::of(8080);
+  // meta::BoundedInt<1, 65535> admin = meta::BoundedInt<1, 65535>::of(70000);  // does not compile
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&ServerDefaults::host>("host", "Bind host", meta::OptionalField),
+        meta::Field<&ServerDefaults::port>("port", "Bind port", meta::OptionalField)
+    };
+};
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -173,6 +224,83 @@ int main() {
         std::cout << "✓ Valid config:\n" << meta::toString(*config7);
     }
     
+    // ========================================
+    // Example 8: Parse into an arena
+    // ========================================
+    std::cout << "\n--- Example 8: Arena-Backed Parse ---\n";
+    
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        auto [config8, result8] = meta::fromYamlWithValidation<ArenaConfig>(good_config, &arena);
+        if (config8) {
+            std::cout << "✓ Parsed into arena:\n" << meta::toString(*config8);
+            // region is not in the YAML: its in-class default survives the rebind
+            bool kept = config8->region == "eu-west-1 (default region)" &&
+                        config8->region.get_allocator().resource() == &arena;
+            std::cout << (kept ? "✓" : "✗") << " Default region kept, now in the arena\n";
+        }
+        // config8 goes first, then the arena frees everything in one go
+    }
+    
+    // ========================================
+    // Example 9: Bounded, inline vector
+    // ========================================
+    std::cout << "\n--- Example 9: BoundedVector ---\n";
+    
+    YAML::Node cluster_yaml = YAML::Load(R"(
+        primary: db1.example.com
+        backups: [db2.example.com, db3.example.com]
+    )");
+    
+    auto [cluster, result9] = meta::fromYamlWithValidation<ClusterConfig>(cluster_yaml);
+    if (cluster) {
+        std::cout << "✓ Parsed (sizeof(ClusterConfig) = " << sizeof(ClusterConfig) << "):\n"
+                  << meta::toString(*cluster);
+    }
+    
+    YAML::Node too_many = YAML::Load(R"(
+        primary: db1.example.com
+        backups: [db2, db3, db4, db5]
+    )");
+    
+    auto [cluster2, result10] = meta::fromYamlWithValidation<ClusterConfig>(too_many);
+    if (!cluster2) {
+        std::cout << "✗ Too many backups:\n";
+        for (const auto& [field, error] : result10.errors) {
+            std::cout << "  " << field << ": " << error << "\n";
+        }
+    }
+    
+    // ========================================
+    // Example 10: Range-sized integers
+    // ========================================
+    std::cout << "\n--- Example 10: Range-Sized BoundedInt ---\n";
+    
+    YAML::Node reading_yaml = YAML::Load(R"(
+        humidity: 48
+        celsius: -12
+        pressure: 1013
+    )");
+    
+    auto [reading, result11] = meta::fromYamlWithValidation<Reading>(reading_yaml);
+    if (reading) {
+        std::cout << "✓ Parsed (sizeof(Reading) = " << sizeof(Reading) << "):\n"
+                  << meta::toString(*reading);
+    }
+    
+    // ========================================
+    // Example 11: Compile-time checked defaults
+    // ========================================
+    std::cout << "\n--- Example 11: Checked Defaults ---\n";
+    
+    YAML::Node partial = YAML::Load("port: 9000");
+    
+    auto [server, result12] = meta::fromYamlWithValidation<ServerDefaults>(partial);
+    if (server) {
+        std::cout << "✓ Missing host falls back to its default:\n"
+                  << meta::toString(*server);
+    }
+    
     std::cout << "\n=== Done ===\n";
     return 0;
 }
@@ -1,6 +1,15 @@
 #pragma once
 #include "meta.h"
+#include "inline_string.h"
+#include "inline_vector.h"
+#include "unique.h"
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 namespace meta {
 
@@ -8,37 +17,165 @@ namespace meta {
 // USER-DEFINED BOUNDED INT (external to framework)
 // ============================================================================
 
+// How a BoundedInt lays out its value:
+//   Direct - the value itself, in the smallest integer that holds
+//            [Min - 1, Max + 1]
+//   Offset - value - (Min - 1), in the smallest unsigned integer that holds
+//            Max - Min + 2 (so <950, 1150> fits in one byte)
+// The spare value past each bound is where out-of-range values end up when
+// the storage cannot hold them exactly, so they still fail isValid().
+enum class IntEncoding : uint8_t {
+    Direct,
+    Offset
+};
+
+// Smallest integer type that can hold every value in [Lo, Hi]
+template<int64_t Lo, int64_t Hi>
+using smallest_int_t =
+    std::conditional_t<(Lo >= 0),
+        std::conditional_t<(Hi <= UINT8_MAX), uint8_t,
+        std::conditional_t<(Hi <= UINT16_MAX), uint16_t, uint32_t>>,
+        std::conditional_t<(Lo >= INT8_MIN && Hi <= INT8_MAX), int8_t,
+        std::conditional_t<(Lo >= INT16_MIN && Hi <= INT16_MAX), int16_t, int32_t>>>;
+
+// Checked literals for BoundedInt::of / BoundedString::of. The constructors
+// are consteval, so a constant outside the bounds is a compile error rather
+// than something isValid() finds at runtime.
 template<int Min, int Max>
+struct IntLiteral {
+    int value;
+
+    consteval IntLiteral(int v) : value(v) {
+        if (v < Min || v > Max) {
+            throw "BoundedInt literal out of bounds";
+        }
+    }
+};
+
+template<size_t MinLen, size_t MaxLen>
+struct StringLiteral {
+    std::string_view value;
+
+    consteval StringLiteral(const char* s) : value(s) {
+        if (value.length() < MinLen || value.length() > MaxLen) {
+            throw "BoundedString literal length out of bounds";
+        }
+    }
+};
+
+// The value is kept in `raw`, sized to the range (see IntEncoding); read it
+// with value() and write it with set(). `raw` replaces the old `int val`.
+template<int Min, int Max, IntEncoding Encoding = IntEncoding::Direct>
 struct BoundedInt {
-    int val;
+    static_assert(Min <= Max, "BoundedInt needs Min <= Max");
+
+    // Spare values only where an int can fall outside the range
+    static constexpr int64_t lowest = int64_t{Min} - (Min > INT32_MIN);
+    static constexpr int64_t highest = int64_t{Max} + (Max < INT32_MAX);
+
+    using storage_type = std::conditional_t<Encoding == IntEncoding::Offset,
+        smallest_int_t<0, highest - lowest>,
+        smallest_int_t<lowest, highest>>;
+
+    storage_type raw;
     
-    // Default constructor - no validation, just initializes to Min
-    BoundedInt(int v = Min) : val(v) {}
+    // Default constructor - no validation, just assigns (initializes to Min).
+    // An out-of-range value is kept if the storage can hold it and otherwise
+    // saturates to the nearest value it can; either way isValid() is false.
+    constexpr BoundedInt(int v = Min) : raw(encode(v)) {}
+
+    // Checked at compile time: BoundedInt<0, 150>::of(200) does not build
+    static constexpr BoundedInt of(IntLiteral<Min, Max> v) { return BoundedInt(v.value); }
     
     static constexpr int min = Min;
     static constexpr int max = Max;
+    static constexpr IntEncoding encoding = Encoding;
     
-    bool isValid() const { return val >= Min && val <= Max; }
+    constexpr int value() const {
+        if constexpr (Encoding == IntEncoding::Offset) {
+            return static_cast<int>(int64_t{raw} + lowest);
+        } else {
+            return raw;
+        }
+    }
+
+    constexpr void set(int v) { raw = encode(v); }
+
+    constexpr bool isValid() const { return value() >= Min && value() <= Max; }
+
+private:
+    static constexpr storage_type encode(int v) {
+        int64_t stored = int64_t{v};
+        if constexpr (Encoding == IntEncoding::Offset) {
+            stored -= lowest;
+        }
+        return static_cast<storage_type>(std::clamp<int64_t>(stored,
+            std::numeric_limits<storage_type>::min(), std::numeric_limits<storage_type>::max()));
+    }
 };
 
 // ============================================================================
 // USER-DEFINED BOUNDED STRING (external to framework)
 // ============================================================================
 
-template<size_t MinLen, size_t MaxLen>
+// Storage defaults to InlineString<MaxLen> (characters kept in the object)
+// for MaxLen up to kInlineStringMaxLen, and std::string above that
+template<size_t MinLen, size_t MaxLen, typename String = default_string_storage_t<MaxLen>>
 struct BoundedString {
-    std::string val;
+    using allocator_type = allocator_of_t<String>;
+
+    String val;
     
     // Default constructor - creates valid default string of MinLen spaces
-    BoundedString() : val(std::string(MinLen, ' ')) {}
+    constexpr BoundedString() : val(MinLen, ' ') {}
+
+    // Allocator-extended default constructor (used when binding to a memory resource)
+    template<typename Alloc>
+        requires std::constructible_from<String, size_t, char, const Alloc&>
+    explicit BoundedString(const Alloc& alloc) : val(MinLen, ' ', alloc) {}
     
-    // Parameterized constructor - no validation, just assigns
-    BoundedString(const std::string& v) : val(v) {}
+    // Parameterized constructor - no validation, just assigns (inline storage
+    // throws std::length_error if v cannot fit at all)
+    BoundedString(const std::string& v) : val(std::string_view(v)) {}
+
+    // Checked at compile time: the literal's length must be in [MinLen, MaxLen]
+    static constexpr BoundedString of(StringLiteral<MinLen, MaxLen> s) {
+        BoundedString result;
+        result.val.assign(s.value);
+        return result;
+    }
     
     static constexpr size_t minLen = MinLen;
     static constexpr size_t maxLen = MaxLen;
     
-    bool isValid() const { return val.length() >= MinLen && val.length() <= MaxLen; }
+    constexpr bool isValid() const { return val.length() >= MinLen && val.length() <= MaxLen; }
+};
+
+// ============================================================================
+// USER-DEFINED BOUNDED VECTOR (external to framework)
+// ============================================================================
+
+// Between Min and Max elements, stored inline (no heap for the vector itself).
+// With UniqueElements, parsing also rejects repeated elements (one O(n) pass).
+template<typename T, size_t Min, size_t Max, typename Duplicates = AllowDuplicates>
+struct BoundedVector {
+    InlineVector<T, Max> val;
+    
+    static constexpr size_t minSize = Min;
+    static constexpr size_t maxSize = Max;
+    
+    bool isValid() const {
+        if (val.size() < Min || val.size() > Max) return false;
+        if constexpr (is_unique_v<Duplicates>) {
+            return !detail::findDuplicate(val).has_value();
+        }
+        return true;
+    }
+
+    size_t size() const { return val.size(); }
+    auto begin() const { return val.begin(); }
+    auto end() const { return val.end(); }
+    const T& operator[](size_t i) const { return val[i]; }
 };
 
 // ============================================================================
@@ -46,11 +183,11 @@ struct BoundedString {
 // ============================================================================
 
 // Register BoundedInt as YamlSerializable with validation in parse
-template<int Min, int Max>
-struct YamlTraits<BoundedInt<Min, Max>> {
-    using type = BoundedInt<Min, Max>;
+template<int Min, int Max, IntEncoding Encoding>
+struct YamlTraits<BoundedInt<Min, Max, Encoding>> {
+    using type = BoundedInt<Min, Max, Encoding>;
     
-    static ValidationResult parse(BoundedInt<Min, Max>& obj, const YAML::Node& node) {
+    static ValidationResult parse(BoundedInt<Min, Max, Encoding>& obj, const YAML::Node& node) {
         int value;
         try {
             value = node.template as<int>();
@@ -69,27 +206,32 @@ struct YamlTraits<BoundedInt<Min, Max>> {
             return result;
         }
         
-        obj.val = value;
+        obj.set(value);
         return ValidationResult();
     }
     
-    static std::string toString(const BoundedInt<Min, Max>& obj) {
-        return std::to_string(obj.val);
+    static std::string toString(const BoundedInt<Min, Max, Encoding>& obj) {
+        return std::to_string(obj.value());
     }
 };
 
 // Register BoundedString as YamlSerializable with validation in parse
-template<size_t MinLen, size_t MaxLen>
-struct YamlTraits<BoundedString<MinLen, MaxLen>> {
-    using type = BoundedString<MinLen, MaxLen>;
+template<size_t MinLen, size_t MaxLen, typename String>
+struct YamlTraits<BoundedString<MinLen, MaxLen, String>> {
+    using type = BoundedString<MinLen, MaxLen, String>;
     
-    static ValidationResult parse(BoundedString<MinLen, MaxLen>& obj, const YAML::Node& node) {
-        std::string value;
-        try {
-            value = node.template as<std::string>();
-        } catch (const std::exception& e) {
+    static ValidationResult parse(BoundedString<MinLen, MaxLen, String>& obj, const YAML::Node& node) {
+        // Read in place and copied once, straight into obj.val, so nothing
+        // is allocated outside the resource obj is bound to
+        std::string_view value;
+        if (node.IsScalar()) {
+            value = node.Scalar();
+        } else if (node.IsNull()) {
+            value = "null";  // what node.as<std::string>() gives for ~
+        } else {
             ValidationResult result;
-            result.addError("", std::string("Invalid string: ") + e.what());
+            result.addError("", std::string("Invalid string: ") +
+                                YAML::TypedBadConversion<std::string>(node.Mark()).what());
             return result;
         }
         
@@ -103,14 +245,82 @@ struct YamlTraits<BoundedString<MinLen, MaxLen>> {
             return result;
         }
         
-        obj.val = value;
+        obj.val.assign(value);
         return ValidationResult();
     }
     
-    static std::string toString(const BoundedString<MinLen, MaxLen>& obj) {
-        return obj.val;
+    static std::string toString(const BoundedString<MinLen, MaxLen, String>& obj) {
+        return std::string(std::string_view(obj.val));
     }
 };
 
+// Register BoundedVector; the length is checked before any element is decoded
+template<typename T, size_t Min, size_t Max, typename Duplicates>
+struct YamlTraits<BoundedVector<T, Min, Max, Duplicates>> {
+    using type = BoundedVector<T, Min, Max, Duplicates>;
+    
+    static ValidationResult parse(BoundedVector<T, Min, Max, Duplicates>& obj, const YAML::Node& node) {
+        ValidationResult result;
+        if (!node.IsSequence()) {
+            result.addError("", "Expected sequence");
+            return result;
+        }
+        
+        if (node.size() < Min || node.size() > Max) {
+            result.addError("", 
+                "Sequence length " + std::to_string(node.size()) + 
+                " out of bounds [" + std::to_string(Min) + ", " + 
+                std::to_string(Max) + "]"
+            );
+            return result;
+        }
+        
+        obj.val.clear();
+        size_t index = 0;
+        for (const auto& item : node) {
+            T& element = obj.val.emplace_back();
+            try {
+                result.mergeErrors(std::to_string(index), dispatchParse(element, item));
+            } catch (const std::exception& e) {
+                result.addError(std::to_string(index), std::string("Invalid element: ") + e.what());
+            }
+            index++;
+        }
+
+        if constexpr (is_unique_v<Duplicates>) {
+            if (result.valid) {
+                if (auto duplicate = detail::findDuplicate(obj.val)) {
+                    result.addError(std::to_string(*duplicate),
+                        "Duplicate " + detail::describeElement(obj.val[*duplicate]));
+                }
+            }
+        }
+        return result;
+    }
+    
+    static std::string toString(const BoundedVector<T, Min, Max, Duplicates>& obj) {
+        std::string result = "[";
+        bool first = true;
+        for (const auto& v : obj.val) {
+            if (!first) result += ", ";
+            result += dispatchToString(v);
+            first = false;
+        }
+        result += "]";
+        return result;
+    }
+};
+
+// ============================================================================
+// STD::PMR VARIANTS
+// ============================================================================
+
+namespace pmr {
+
+template<size_t MinLen, size_t MaxLen>
+using BoundedString = meta::BoundedString<MinLen, MaxLen, std::pmr::string>;
+
+} // namespace pmr
+
 } // namespace meta
 
@@ -0,0 +1,73 @@
+#include "containers2.h"
+#include "concurrent_map.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main() {
+    std::cout << "=== Concurrent Constrained Map ===\n\n";
+
+    using Registry = meta::ConcurrentConstrainedMap<
+        std::string,
+        int,
+        meta::NonEmptyStringConstraint,
+        meta::PositiveConstraint
+    >;
+
+    Registry registry;
+
+    // ========================================
+    // Initial load (one batch, one copy per shard)
+    // ========================================
+    std::cout << "--- Initial Load ---\n";
+
+    std::vector<std::pair<std::string, int>> initial{
+        {"workers", 8}, {"max_connections", 1000}, {"timeout", 30}
+    };
+    registry.insert_range(initial);
+    std::cout << "✓ Loaded " << registry.size() << " entries into "
+              << Registry::shardCount() << " shards\n";
+
+    // ========================================
+    // Readers and a writer running together
+    // ========================================
+    std::cout << "\n--- Concurrent Readers + Writer ---\n";
+
+    std::atomic<long> hits{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; t++) {
+        readers.emplace_back([&] {
+            for (int i = 0; i < 100000; i++) {
+                if (registry.find(std::string_view("workers"))) hits++;
+            }
+        });
+    }
+
+    std::thread writer([&] {
+        for (int i = 1; i <= 100; i++) {
+            registry.insert("workers", i);
+        }
+    });
+
+    for (auto& r : readers) r.join();
+    writer.join();
+
+    std::cout << "✓ " << hits << " reads (no shard lock), final workers = "
+              << *registry.find("workers") << " (snapshot version "
+              << registry.snapshotFor("workers")->version << ")\n";
+
+    // ========================================
+    // Constraint violations never reach a shard
+    // ========================================
+    std::cout << "\n--- Invalid Value ---\n";
+
+    try {
+        registry.insert("timeout", -1);
+        std::cout << "✓ Inserted\n";
+    } catch (const std::exception& e) {
+        std::cout << "✗ " << e.what() << "\n";
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
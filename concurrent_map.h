@@ -0,0 +1,359 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage.h"
+
+namespace meta {
+
+// ============================================================================
+// CONCURRENT CONSTRAINED MAP
+// ============================================================================
+//
+// Sharded, read-mostly variant of ConstrainedMap for process-wide registries.
+//
+//   - Constraints are checked before any lock is taken.
+//   - Keys are spread over Shards independent shards by hash.
+//   - Each shard publishes an immutable, versioned snapshot through a plain
+//     atomic pointer. Readers load it inside an epoch guard and touch no
+//     lock and no shared counter; writers copy the snapshot, modify the
+//     copy, publish it and retire the old one (copy-on-write).
+//   - A retired snapshot is freed once every reader that could still see
+//     it has left its guard (epoch-based reclamation, below).
+//
+// Writes cost a copy of one shard, so this suits registries that are read
+// far more often than they are updated.
+//
+// Usage:
+//   meta::ConcurrentConstrainedMap<std::string, int,
+//                                  meta::NonEmptyStringConstraint,
+//                                  meta::PositiveConstraint> registry;
+//   registry.insert("workers", 8);             // any thread
+//   if (auto n = registry.find("workers")) ... // any thread, no lock
+//
+
+namespace detail {
+
+// ============================================================================
+// EPOCH-BASED RECLAMATION
+// ============================================================================
+//
+// A reader announces the global epoch in its own cache line when it enters
+// a guard and clears it on leaving. A writer retires an unpublished
+// snapshot tagged with the current epoch; the epoch only advances once
+// every active reader has announced it, so an object retired in epoch e
+// can no longer be reachable from any guard once the epoch reaches e + 2.
+//
+// Reader cost is one thread_local lookup and two stores to a line no other
+// thread writes. Guards nest; only the outermost announces.
+
+class EpochDomain {
+public:
+    static EpochDomain& instance() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    // Runs after every map has gone (maps touch instance() on construction)
+    ~EpochDomain() {
+        for (const auto& r : retired_) r.destroy(r.ptr);
+        for (Record* r = records_.load(std::memory_order_acquire); r;) delete std::exchange(r, r->next);
+    }
+
+    void enter() {
+        Local& local = localRecord();
+        if (local.depth++ == 0) {
+            local.record->epoch.store(epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+    }
+
+    void leave() {
+        Local& local = localRecord();
+        if (--local.depth == 0) {
+            local.record->epoch.store(kQuiescent, std::memory_order_release);
+        }
+    }
+
+    // ptr must already be unreachable for new readers
+    void retire(void* ptr, void (*destroy)(void*)) {
+        std::vector<Retired> ready;
+        {
+            std::lock_guard lock(retiredMutex_);
+            retired_.push_back({ptr, destroy, epoch_.load(std::memory_order_seq_cst)});
+            tryAdvance();
+            uint64_t now = epoch_.load(std::memory_order_relaxed);
+            std::erase_if(retired_, [&](const Retired& r) {
+                if (r.epoch + 2 > now) return false;
+                ready.push_back(r);
+                return true;
+            });
+        }
+        for (const auto& r : ready) r.destroy(r.ptr);
+    }
+
+private:
+    static constexpr uint64_t kQuiescent = 0;
+
+    struct alignas(64) Record {
+        std::atomic<uint64_t> epoch{kQuiescent};
+        std::atomic<bool> inUse{true};
+        Record* next = nullptr;
+    };
+
+    // A thread's claim on a Record, given back when the thread exits
+    struct Local {
+        Record* record;
+        unsigned depth = 0;
+
+        explicit Local(EpochDomain& domain) : record(domain.acquireRecord()) {}
+        ~Local() { record->inUse.store(false, std::memory_order_release); }
+    };
+
+    struct Retired {
+        void* ptr;
+        void (*destroy)(void*);
+        uint64_t epoch;
+    };
+
+    std::atomic<uint64_t> epoch_{1};
+    std::atomic<Record*> records_{nullptr};  // never shrinks; records are reused
+    std::mutex retiredMutex_;
+    std::vector<Retired> retired_;
+
+    EpochDomain() = default;
+
+    Local& localRecord() {
+        thread_local Local local(*this);
+        return local;
+    }
+
+    Record* acquireRecord() {
+        for (Record* r = records_.load(std::memory_order_acquire); r; r = r->next) {
+            bool free = false;
+            if (!r->inUse.load(std::memory_order_relaxed) &&
+                r->inUse.compare_exchange_strong(free, true, std::memory_order_acquire)) {
+                return r;
+            }
+        }
+        auto* r = new Record;
+        Record* head = records_.load(std::memory_order_relaxed);
+        do {
+            r->next = head;
+        } while (!records_.compare_exchange_weak(head, r, std::memory_order_release, std::memory_order_relaxed));
+        return r;
+    }
+
+    // Caller holds retiredMutex_
+    void tryAdvance() {
+        uint64_t now = epoch_.load(std::memory_order_seq_cst);
+        for (Record* r = records_.load(std::memory_order_acquire); r; r = r->next) {
+            uint64_t seen = r->epoch.load(std::memory_order_seq_cst);
+            if (seen != kQuiescent && seen != now) return;
+        }
+        epoch_.store(now + 1, std::memory_order_seq_cst);
+    }
+};
+
+}  // namespace detail
+
+template<typename K, typename V, typename KeyConstraint, typename ValueConstraint,
+         size_t Shards = 16, typename Storage = HashStorage>
+class ConcurrentConstrainedMap {
+    static_assert(std::has_single_bit(Shards), "Shards must be a power of two");
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using container_type = typename Storage::template container<K, V>;
+
+    struct Snapshot {
+        uint64_t version = 0;
+        container_type data;
+    };
+
+    // A snapshot pinned for as long as the ref lives; it is never modified,
+    // and is not freed until the ref (and every other guard) is gone
+    class SnapshotRef {
+    public:
+        SnapshotRef(const SnapshotRef&) = delete;
+        SnapshotRef& operator=(const SnapshotRef&) = delete;
+
+        SnapshotRef(SnapshotRef&& other) noexcept : snapshot_(std::exchange(other.snapshot_, nullptr)) {}
+
+        ~SnapshotRef() {
+            if (snapshot_) detail::EpochDomain::instance().leave();
+        }
+
+        const Snapshot& operator*() const { return *snapshot_; }
+        const Snapshot* operator->() const { return snapshot_; }
+        const Snapshot* get() const { return snapshot_; }
+
+    private:
+        friend class ConcurrentConstrainedMap;
+
+        explicit SnapshotRef(const std::atomic<const Snapshot*>& current) {
+            detail::EpochDomain::instance().enter();
+            snapshot_ = current.load(std::memory_order_seq_cst);
+        }
+
+        const Snapshot* snapshot_;
+    };
+
+    ConcurrentConstrainedMap() {
+        detail::EpochDomain::instance();  // constructed first, so destroyed after this map
+        for (auto& shard : shards_) {
+            shard.current.store(new Snapshot(), std::memory_order_release);
+        }
+    }
+
+    // No reader may still be using the map
+    ~ConcurrentConstrainedMap() {
+        for (auto& shard : shards_) {
+            delete shard.current.load(std::memory_order_acquire);
+        }
+    }
+
+    ConcurrentConstrainedMap(const ConcurrentConstrainedMap&) = delete;
+    ConcurrentConstrainedMap& operator=(const ConcurrentConstrainedMap&) = delete;
+
+    void insert(K key, V value) {
+        checkKey(key);
+        checkValue(value);
+
+        Shard& shard = shards_[shardOf(key)];
+        std::lock_guard lock(shard.writeMutex);
+        auto next = std::make_unique<Snapshot>(*shard.current.load(std::memory_order_relaxed));
+        next->data.insert_or_assign(std::move(key), std::move(value));
+        next->data.flush();  // merged once here; published snapshots are never modified
+        next->version++;
+        publish(shard, std::move(next));
+    }
+
+    // All entries are validated up front. Each touched shard is then copied
+    // and published once, so a batch of N updates costs one copy per shard
+    // rather than N. Readers may briefly see some shards updated and others
+    // not.
+    void insert_range(std::span<const std::pair<K, V>> entries) {
+        for (const auto& [key, value] : entries) {
+            checkKey(key);
+            checkValue(value);
+        }
+
+        std::vector<std::vector<const std::pair<K, V>*>> byShard(Shards);
+        for (const auto& entry : entries) {
+            byShard[shardOf(entry.first)].push_back(&entry);
+        }
+
+        for (size_t i = 0; i < Shards; i++) {
+            if (byShard[i].empty()) continue;
+            Shard& shard = shards_[i];
+            std::lock_guard lock(shard.writeMutex);
+            auto next = std::make_unique<Snapshot>(*shard.current.load(std::memory_order_relaxed));
+            for (const auto* entry : byShard[i]) {
+                next->data.insert_or_assign(entry->first, entry->second);
+            }
+            next->data.flush();
+            next->version++;
+            publish(shard, std::move(next));
+        }
+    }
+
+    template<typename Q = K>
+    std::optional<V> find(const Q& key) const {
+        auto snap = snapshotFor(key);
+        const V* value = snap->data.find(key);
+        return value ? std::optional<V>(*value) : std::nullopt;
+    }
+
+    template<typename Q = K>
+    bool contains(const Q& key) const {
+        return snapshotFor(key)->data.find(key) != nullptr;
+    }
+
+    // Consistent view of the shard that owns key; stays valid (and
+    // unchanged) for as long as the caller holds it
+    template<typename Q = K>
+    SnapshotRef snapshotFor(const Q& key) const {
+        return SnapshotRef(shards_[shardOf(key)].current);
+    }
+
+    // Sum of per-shard sizes; shards are sampled one after another
+    size_t size() const {
+        size_t total = 0;
+        for (const auto& shard : shards_) {
+            total += SnapshotRef(shard.current)->data.size();
+        }
+        return total;
+    }
+
+    template<typename Func>
+    void forEach(Func f) const {
+        for (const auto& shard : shards_) {
+            SnapshotRef snap(shard.current);
+            for (const auto& [key, value] : snap->data) {
+                f(key, value);
+            }
+        }
+    }
+
+    static constexpr size_t shardCount() { return Shards; }
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<const Snapshot*> current{nullptr};
+        std::mutex writeMutex;
+    };
+
+    Shard shards_[Shards];
+
+    // Caller holds shard.writeMutex
+    static void publish(Shard& shard, std::unique_ptr<Snapshot> next) {
+        const Snapshot* old = shard.current.exchange(next.release(), std::memory_order_seq_cst);
+        detail::EpochDomain::instance().retire(const_cast<Snapshot*>(old), [](void* p) {
+            delete static_cast<Snapshot*>(p);
+        });
+    }
+
+    // Fibonacci hashing on top of the key hash so that weak hashes (e.g. ints)
+    // still spread across shards
+    template<typename Q>
+    static size_t shardOf(const Q& key) {
+        uint64_t h = detail::StorageHash<K>{}(key) * 0x9E3779B97F4A7C15ull;
+        if constexpr (Shards == 1) {
+            return 0;
+        } else {
+            return static_cast<size_t>(h >> (64 - std::countr_zero(Shards)));
+        }
+    }
+
+    static void checkKey(const K& key) {
+        if (!KeyConstraint::validate(key)) {
+            throw std::runtime_error(
+                "Key constraint violated: " + KeyConstraint::error(key)
+            );
+        }
+    }
+
+    static void checkValue(const V& value) {
+        if (!ValueConstraint::validate(value)) {
+            throw std::runtime_error(
+                "Value constraint violated: " + ValueConstraint::error(value)
+            );
+        }
+    }
+};
+
+}  // namespace meta
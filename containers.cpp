@@ -104,6 +104,23 @@ int main() {
         std::cout << "✗ " << e.what() << "\n";
     }
 
+    // ========================================
+    // Vector: Bulk append (all or nothing)
+    // ========================================
+    std::cout << "\n--- Vector: Bulk Append ---\n";
+
+    try {
+        std::vector<int> batch{70, 81, 99};
+        scores.append_range(batch);
+        std::cout << "✓ Appended batch, size now " << scores.size() << "\n";
+
+        std::vector<int> badBatch{60, -1, 75};
+        scores.append_range(badBatch);
+        std::cout << "✓ Appended\n";
+    } catch (const std::exception& e) {
+        std::cout << "✗ " << e.what() << " (size still " << scores.size() << ")\n";
+    }
+
     // ========================================
     // Vector: Non-empty strings
     // ========================================
@@ -1,9 +1,21 @@
 #pragma once
 
 #include <map>
+#include <memory_resource>
 #include <vector>
+#include <algorithm>
 #include <concepts>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "flat_set.h"
+#include "inline_vector.h"
+#include "storage.h"
+#include "unique.h"
+#include "validate_range.h"
 
 namespace meta {
 
@@ -11,47 +23,82 @@ namespace meta {
 // CONSTRAINED MAP
 // ============================================================================
 
-template<typename K, typename V, typename KeyConstraint, typename ValueConstraint>
+template<typename K, typename V, typename KeyConstraint, typename ValueConstraint,
+         typename Storage = OrderedStorage>
 class ConstrainedMap {
 public:
     using key_type = K;
     using mapped_type = V;
     using value_type = std::pair<const K, V>;
-    using container_type = std::map<K, V>;
+    using container_type = typename Storage::template container<K, V>;
+    using allocator_type = typename container_type::allocator_type;
     using iterator = typename container_type::iterator;
     using const_iterator = typename container_type::const_iterator;
 
     ConstrainedMap() = default;
 
+    template<typename Alloc>
+        requires std::constructible_from<container_type, const Alloc&>
+    explicit ConstrainedMap(const Alloc& alloc) : data_(alloc) {}
+
     void insert(const K& key, const V& value) {
-        if (!KeyConstraint::validate(key)) {
-            throw std::runtime_error(
-                "Key constraint violated: " + KeyConstraint::error(key)
-            );
+        checkKey(key);
+        checkValue(value);
+        data_.insert_or_assign(key, value);
+    }
+
+    void insert(K&& key, V&& value) {
+        checkKey(key);
+        checkValue(value);
+        data_.insert_or_assign(std::move(key), std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace(K key, Args&&... args) {
+        V value(std::forward<Args>(args)...);
+        checkKey(key);
+        checkValue(value);
+        data_.insert_or_assign(std::move(key), std::move(value));
+    }
+
+    // All-or-nothing: every entry is validated before any is inserted
+    void insert_range(std::span<const std::pair<K, V>> entries) {
+        for (const auto& [key, value] : entries) {
+            checkKey(key);
+            checkValue(value);
         }
-        if (!ValueConstraint::validate(value)) {
-            throw std::runtime_error(
-                "Value constraint violated: " + ValueConstraint::error(value)
-            );
+        if constexpr (requires { data_.insert_range(entries); }) {
+            data_.insert_range(entries);  // one sort and merge for flat storage
+        } else {
+            for (const auto& [key, value] : entries) {
+                data_.insert_or_assign(key, value);
+            }
         }
-        data_[key] = value;
     }
 
     V& operator[](const K& key) {
-        if (!KeyConstraint::validate(key)) {
-            throw std::runtime_error(
-                "Key constraint violated: " + KeyConstraint::error(key)
-            );
-        }
+        checkKey(key);
         return data_[key];
     }
 
-    const V& at(const K& key) const {
-        return data_.at(key);
+    // Lookups are heterogeneous: a std::string-keyed map accepts string_view
+    template<typename Q = K>
+    const V& at(const Q& key) const {
+        const V* value = data_.find(key);
+        if (!value) {
+            throw std::out_of_range("ConstrainedMap::at: key not found");
+        }
+        return *value;
+    }
+
+    template<typename Q = K>
+    bool contains(const Q& key) const {
+        return data_.find(key) != nullptr;
     }
 
-    bool contains(const K& key) const {
-        return data_.count(key) > 0;
+    // Compact the backing store for read-mostly use once loading is done
+    void freeze() {
+        data_.freeze();
     }
 
     size_t size() const { return data_.size(); }
@@ -64,32 +111,115 @@ public:
 
 private:
     container_type data_;
+
+    static void checkKey(const K& key) {
+        if (!KeyConstraint::validate(key)) {
+            throw std::runtime_error(
+                "Key constraint violated: " + KeyConstraint::error(key)
+            );
+        }
+    }
+
+    static void checkValue(const V& value) {
+        if (!ValueConstraint::validate(value)) {
+            throw std::runtime_error(
+                "Value constraint violated: " + ValueConstraint::error(value)
+            );
+        }
+    }
 };
 
 // ============================================================================
 // CONSTRAINED VECTOR
 // ============================================================================
 
-template<typename T, typename ElementConstraint>
+// Duplicates = UniqueElements rejects an element that is already present:
+// O(log n) per insert with a FlatSet container, O(1) expected otherwise
+// through a hash index of positions kept next to the elements; append_range
+// checks the whole batch in O(batch size). With UniqueElements, elements are
+// read-only once added (const operator[] / at, iterator is const_iterator,
+// as for std::set): editing or reordering them in place would bypass the
+// duplicate check and the index.
+template<typename T, typename ElementConstraint, typename Container = std::vector<T>,
+         typename Duplicates = AllowDuplicates>
 class ConstrainedVector {
 public:
     using value_type = T;
-    using container_type = std::vector<T>;
-    using iterator = typename container_type::iterator;
+    using container_type = Container;
+    using allocator_type = typename container_type::allocator_type;
     using const_iterator = typename container_type::const_iterator;
+    using iterator = std::conditional_t<is_unique_v<Duplicates>, const_iterator,
+                                        typename container_type::iterator>;
 
     ConstrainedVector() = default;
 
+    template<typename Alloc>
+        requires std::constructible_from<container_type, const Alloc&>
+    explicit ConstrainedVector(const Alloc& alloc)
+        : data_(alloc), index_(detail::makeUniqueIndex<Index>(data_)) {}
+
     void push_back(const T& value) {
-        if (!ElementConstraint::validate(value)) {
-            throw std::runtime_error(
-                "Element constraint violated: " + ElementConstraint::error(value)
-            );
-        }
+        checkElement(value);
+        checkNew(value);
+        reserveIndex(1);
         data_.push_back(value);
+        indexFrom(data_.size() - 1);
+    }
+
+    void push_back(T&& value) {
+        checkElement(value);
+        checkNew(value);
+        reserveIndex(1);
+        data_.push_back(std::move(value));
+        indexFrom(data_.size() - 1);
+    }
+
+    template<typename... Args>
+    decltype(auto) emplace_back(Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        checkElement(value);
+        checkNew(value);
+        reserveIndex(1);
+        decltype(auto) element = data_.emplace_back(std::move(value));
+        indexFrom(data_.size() - 1);
+        return element;
     }
 
-    T& operator[](size_t index) {
+    // All-or-nothing: the whole range is validated (in one batch when the
+    // constraint supports it) before capacity is reserved and it is copied in
+    void append_range(std::span<const T> values) {
+        if (!detail::validateRange<ElementConstraint>(values)) {
+            for (const auto& value : values) {
+                checkElement(value);
+            }
+        }
+        if constexpr (indexed) {
+            for (const auto& value : values) {
+                if (index_.contains(data_, value)) duplicateError(value);
+            }
+            if (auto index = detail::findDuplicate(values)) {
+                duplicateError(values[*index]);
+            }
+        } else if constexpr (is_unique_v<Duplicates>) {
+            if (auto index = detail::findDuplicate(data_, values)) {
+                duplicateError(values[*index]);
+            }
+        }
+        size_t first = data_.size();
+        data_.reserve(first + values.size());
+        reserveIndex(values.size());
+        data_.insert(data_.end(), values.begin(), values.end());
+        indexFrom(first);
+    }
+
+    void reserve(size_t n) {
+        data_.reserve(n);
+        if constexpr (indexed) index_.reserve(data_, n);
+    }
+
+    T& operator[](size_t index)
+        requires(!is_unique_v<Duplicates>)
+    {
         return data_[index];
     }
 
@@ -97,7 +227,9 @@ public:
         return data_[index];
     }
 
-    T& at(size_t index) {
+    T& at(size_t index)
+        requires(!is_unique_v<Duplicates>)
+    {
         return data_.at(index);
     }
 
@@ -105,6 +237,19 @@ public:
         return data_.at(index);
     }
 
+    // Binary search with a FlatSet container, a hash lookup when the
+    // elements are indexed, linear scan otherwise
+    template<typename Q>
+    bool contains(const Q& value) const {
+        if constexpr (requires { data_.contains(value); }) {
+            return data_.contains(value);
+        } else if constexpr (indexed && std::is_same_v<detail::unique_key_t<Q>, detail::unique_key_t<T>>) {
+            return index_.contains(data_, value);
+        } else {
+            return std::find(data_.begin(), data_.end(), value) != data_.end();
+        }
+    }
+
     size_t size() const { return data_.size(); }
     bool empty() const { return data_.empty(); }
 
@@ -114,9 +259,60 @@ public:
     const_iterator end() const { return data_.end(); }
 
 private:
+    using Index = detail::unique_index_for_t<T, Container, Duplicates>;
+    static constexpr bool indexed = !std::is_same_v<Index, std::monostate>;
+
     container_type data_;
+    [[no_unique_address]] Index index_;
+
+    static void checkElement(const T& value) {
+        if (!ElementConstraint::validate(value)) {
+            throw std::runtime_error(
+                "Element constraint violated: " + ElementConstraint::error(value)
+            );
+        }
+    }
+
+    void checkNew(const T& value) const {
+        if constexpr (is_unique_v<Duplicates>) {
+            if (contains(value)) duplicateError(value);
+        }
+    }
+
+    // Makes room first, so recording the new positions cannot throw
+    void reserveIndex(size_t added) {
+        if constexpr (indexed) index_.reserve(data_, data_.size() + added);
+    }
+
+    void indexFrom(size_t first) {
+        if constexpr (indexed) {
+            for (size_t i = first; i < data_.size(); i++) index_.add(data_, i);
+        }
+    }
+
+    [[noreturn]] static void duplicateError(const T& value) {
+        throw std::runtime_error("Duplicate element: " + detail::describeElement(value));
+    }
 };
 
+// ============================================================================
+// STD::PMR VARIANTS
+// ============================================================================
+
+namespace pmr {
+
+template<typename K, typename V, typename KeyConstraint, typename ValueConstraint>
+using ConstrainedMap = meta::ConstrainedMap<K, V, KeyConstraint, ValueConstraint, PmrOrderedStorage>;
+
+template<typename T, typename ElementConstraint>
+using ConstrainedVector = meta::ConstrainedVector<T, ElementConstraint, std::pmr::vector<T>>;
+
+}  // namespace pmr
+
+// Elements stored inside the object, at most N of them
+template<typename T, typename ElementConstraint, size_t N>
+using InlineConstrainedVector = ConstrainedVector<T, ElementConstraint, InlineVector<T, N>>;
+
 // ============================================================================
 // CONSTRAINT IMPLEMENTATIONS
 // ============================================================================
@@ -126,6 +322,8 @@ struct NoConstraint {
     static bool validate(const T&) { return true; }
     template <typename T>
     static std::string error(const T&) { return "No constraint"; }
+    template <typename T>
+    static bool validate_batch(std::span<const T>) { return true; }
 };
 
 struct PositiveConstraint {
@@ -136,16 +334,33 @@ struct PositiveConstraint {
     static std::string error(int val) {
         return "Value " + std::to_string(val) + " must be positive";
     }
+
+    // Min-reduction with no early exit vectorises cleanly
+    static bool validate_batch(std::span<const int> vals) {
+        int lowest = 1;
+        for (int v : vals) {
+            lowest = std::min(lowest, v);
+        }
+        return lowest > 0;
+    }
 };
 
 struct NonEmptyStringConstraint {
-    static bool validate(const std::string& s) {
+    static bool validate(std::string_view s) {
         return !s.empty();
     }
 
-    static std::string error(const std::string& s) {
+    static std::string error(std::string_view s) {
         return "String cannot be empty";
     }
+
+    static bool validate_batch(std::span<const std::string> vals) {
+        bool ok = true;
+        for (const auto& s : vals) {
+            ok &= !s.empty();
+        }
+        return ok;
+    }
 };
 
 struct AnyIntConstraint {
@@ -156,16 +371,24 @@ struct AnyIntConstraint {
     static std::string error(int val) {
         return "";
     }
+
+    static bool validate_batch(std::span<const int>) {
+        return true;
+    }
 };
 
 struct AnyStringConstraint {
-    static bool validate(const std::string& s) {
+    static bool validate(std::string_view s) {
         return true;
     }
 
-    static std::string error(const std::string& s) {
+    static std::string error(std::string_view s) {
         return "";
     }
+
+    static bool validate_batch(std::span<const std::string>) {
+        return true;
+    }
 };
 
 }  // namespace meta
@@ -50,6 +50,29 @@ int main() {
         std::cout << "✗ " << e.what() << "\n";
     }
 
+    // ========================================
+    // Map: Hash storage, frozen after loading
+    // ========================================
+    std::cout << "\n--- Map: Hash Storage + freeze() ---\n";
+
+    using LimitsMap = meta::ConstrainedMap<
+        std::string,
+        int,
+        meta::NonEmptyStringConstraint,
+        meta::PositiveConstraint,
+        meta::HashStorage
+    >;
+
+    LimitsMap limits;
+    limits.insert("max_connections", 100);
+    limits.insert("max_body_kb", 512);
+    limits.freeze();
+
+    std::string_view probe = "max_body_kb";
+    if (limits.contains(probe)) {
+        std::cout << "✓ " << probe << " = " << limits.at(probe) << " (string_view lookup)\n";
+    }
+
     // ========================================
     // Map: Only certain keys allowed (whitelist)
     // ========================================
@@ -103,6 +126,19 @@ int main() {
         }
     }
 
+    // ========================================
+    // Whitelist: Batch validation
+    // ========================================
+    std::cout << "\n--- Whitelist: Batch Validation ---\n";
+
+    std::vector<int> requestedPorts{8080, 8082, 3000};
+    std::cout << (portWhitelist.validateAll(requestedPorts) ? "  ✓" : "  ✗")
+              << " Ports 8080, 8082, 3000 all allowed\n";
+
+    std::vector<std::string_view> requestedEnvs{"staging", "qa"};
+    std::cout << (envWhitelist.validateAll(requestedEnvs) ? "  ✓" : "  ✗")
+              << " Environments staging, qa all allowed\n";
+
     // ========================================
     // Map: Both keys AND values constrained
     // ========================================
@@ -1,10 +1,23 @@
 #pragma once
 
 #include <map>
+#include <memory_resource>
 #include <vector>
+#include <algorithm>
 #include <concepts>
+#include <cstdint>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+#include "flat_set.h"
+#include "inline_vector.h"
+#include "storage.h"
+#include "unique.h"
+#include "validate_range.h"
 
 namespace meta {
 
@@ -12,27 +25,71 @@ namespace meta {
 // CONSTRAINED MAP
 // ============================================================================
 
-template<typename K, typename V, typename KeyConstraint, typename ValueConstraint>
+template<typename K, typename V, typename KeyConstraint, typename ValueConstraint,
+         typename Storage = OrderedStorage>
 class ConstrainedMap {
 public:
     using key_type = K;
     using mapped_type = V;
+    using allocator_type = typename Storage::template container<K, V>::allocator_type;
+
+    ConstrainedMap() = default;
+
+    template<typename Alloc>
+        requires std::constructible_from<typename Storage::template container<K, V>, const Alloc&>
+    explicit ConstrainedMap(const Alloc& alloc) : data_(alloc) {}
 
     void insert(const K& key, const V& value) {
-        if (!KeyConstraint::validate(key)) {
-            throw std::runtime_error(
-                "Key constraint violated: " + KeyConstraint::error(key)
-            );
+        checkKey(key);
+        checkValue(value);
+        data_.insert_or_assign(key, value);
+    }
+
+    void insert(K&& key, V&& value) {
+        checkKey(key);
+        checkValue(value);
+        data_.insert_or_assign(std::move(key), std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace(K key, Args&&... args) {
+        V value(std::forward<Args>(args)...);
+        checkKey(key);
+        checkValue(value);
+        data_.insert_or_assign(std::move(key), std::move(value));
+    }
+
+    // All-or-nothing: every entry is validated before any is inserted
+    void insert_range(std::span<const std::pair<K, V>> entries) {
+        for (const auto& [key, value] : entries) {
+            checkKey(key);
+            checkValue(value);
         }
-        if (!ValueConstraint::validate(value)) {
-            throw std::runtime_error(
-                "Value constraint violated: " + ValueConstraint::error(value)
-            );
+        if constexpr (requires { data_.insert_range(entries); }) {
+            data_.insert_range(entries);  // one sort and merge for flat storage
+        } else {
+            for (const auto& [key, value] : entries) {
+                data_.insert_or_assign(key, value);
+            }
         }
-        data_[key] = value;
     }
 
+    // Lookups are heterogeneous: a std::string-keyed map accepts string_view
+    template<typename Q = K>
+    const V& at(const Q& key) const {
+        const V* value = data_.find(key);
+        if (!value) throw std::out_of_range("ConstrainedMap::at: key not found");
+        return *value;
+    }
+
+    template<typename Q = K>
+    bool contains(const Q& key) const { return data_.find(key) != nullptr; }
+
+    // Compact the backing store for read-mostly use once loading is done
+    void freeze() { data_.freeze(); }
+
     size_t size() const { return data_.size(); }
+    bool empty() const { return data_.empty(); }
 
     auto begin() { return data_.begin(); }
     auto end() { return data_.end(); }
@@ -40,39 +97,191 @@ public:
     auto end() const { return data_.end(); }
 
 private:
-    std::map<K, V> data_;
+    typename Storage::template container<K, V> data_;
+
+    static void checkKey(const K& key) {
+        if (!KeyConstraint::validate(key)) {
+            throw std::runtime_error(
+                "Key constraint violated: " + KeyConstraint::error(key)
+            );
+        }
+    }
+
+    static void checkValue(const V& value) {
+        if (!ValueConstraint::validate(value)) {
+            throw std::runtime_error(
+                "Value constraint violated: " + ValueConstraint::error(value)
+            );
+        }
+    }
 };
 
 // ============================================================================
 // CONSTRAINED VECTOR
 // ============================================================================
 
-template<typename T, typename ElementConstraint>
+// Duplicates = UniqueElements rejects an element that is already present:
+// O(log n) per insert with a FlatSet container, O(1) expected otherwise
+// through a hash index of positions kept next to the elements; append_range
+// checks the whole batch in O(batch size). With UniqueElements, elements are
+// read-only once added: editing or reordering them in place would bypass
+// the duplicate check and the index.
+template<typename T, typename ElementConstraint, typename Container = std::vector<T>,
+         typename Duplicates = AllowDuplicates>
 class ConstrainedVector {
 public:
+    using allocator_type = typename Container::allocator_type;
+
+    ConstrainedVector() = default;
+
+    template<typename Alloc>
+        requires std::constructible_from<Container, const Alloc&>
+    explicit ConstrainedVector(const Alloc& alloc)
+        : data_(alloc), index_(detail::makeUniqueIndex<Index>(data_)) {}
+
     void push_back(const T& value) {
-        if (!ElementConstraint::validate(value)) {
-            throw std::runtime_error(
-                "Element constraint violated: " + ElementConstraint::error(value)
-            );
-        }
+        checkElement(value);
+        checkNew(value);
+        reserveIndex(1);
         data_.push_back(value);
+        indexFrom(data_.size() - 1);
+    }
+
+    void push_back(T&& value) {
+        checkElement(value);
+        checkNew(value);
+        reserveIndex(1);
+        data_.push_back(std::move(value));
+        indexFrom(data_.size() - 1);
+    }
+
+    template<typename... Args>
+    decltype(auto) emplace_back(Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        checkElement(value);
+        checkNew(value);
+        reserveIndex(1);
+        decltype(auto) element = data_.emplace_back(std::move(value));
+        indexFrom(data_.size() - 1);
+        return element;
+    }
+
+    // All-or-nothing: the whole range is validated (in one batch when the
+    // constraint supports it) before capacity is reserved and it is copied in
+    void append_range(std::span<const T> values) {
+        if (!detail::validateRange<ElementConstraint>(values)) {
+            for (const auto& value : values) checkElement(value);
+        }
+        if constexpr (indexed) {
+            for (const auto& value : values) {
+                if (index_.contains(data_, value)) duplicateError(value);
+            }
+            if (auto index = detail::findDuplicate(values)) duplicateError(values[*index]);
+        } else if constexpr (is_unique_v<Duplicates>) {
+            if (auto index = detail::findDuplicate(data_, values)) duplicateError(values[*index]);
+        }
+        size_t first = data_.size();
+        data_.reserve(first + values.size());
+        reserveIndex(values.size());
+        data_.insert(data_.end(), values.begin(), values.end());
+        indexFrom(first);
     }
 
-    T& operator[](size_t index) { return data_[index]; }
+    void reserve(size_t n) {
+        data_.reserve(n);
+        if constexpr (indexed) index_.reserve(data_, n);
+    }
+
+    T& operator[](size_t index)
+        requires(!is_unique_v<Duplicates>)
+    {
+        return data_[index];
+    }
     const T& operator[](size_t index) const { return data_[index]; }
 
+    // Binary search with a FlatSet container, a hash lookup when the
+    // elements are indexed, linear scan otherwise
+    template<typename Q>
+    bool contains(const Q& value) const {
+        if constexpr (requires { data_.contains(value); }) {
+            return data_.contains(value);
+        } else if constexpr (indexed && std::is_same_v<detail::unique_key_t<Q>, detail::unique_key_t<T>>) {
+            return index_.contains(data_, value);
+        } else {
+            return std::find(data_.begin(), data_.end(), value) != data_.end();
+        }
+    }
+
     size_t size() const { return data_.size(); }
 
-    auto begin() { return data_.begin(); }
-    auto end() { return data_.end(); }
+    auto begin()
+        requires(!is_unique_v<Duplicates>)
+    {
+        return data_.begin();
+    }
+    auto end()
+        requires(!is_unique_v<Duplicates>)
+    {
+        return data_.end();
+    }
     auto begin() const { return data_.begin(); }
     auto end() const { return data_.end(); }
 
 private:
-    std::vector<T> data_;
+    using Index = detail::unique_index_for_t<T, Container, Duplicates>;
+    static constexpr bool indexed = !std::is_same_v<Index, std::monostate>;
+
+    Container data_;
+    [[no_unique_address]] Index index_;
+
+    static void checkElement(const T& value) {
+        if (!ElementConstraint::validate(value)) {
+            throw std::runtime_error(
+                "Element constraint violated: " + ElementConstraint::error(value)
+            );
+        }
+    }
+
+    void checkNew(const T& value) const {
+        if constexpr (is_unique_v<Duplicates>) {
+            if (contains(value)) duplicateError(value);
+        }
+    }
+
+    // Makes room first, so recording the new positions cannot throw
+    void reserveIndex(size_t added) {
+        if constexpr (indexed) index_.reserve(data_, data_.size() + added);
+    }
+
+    void indexFrom(size_t first) {
+        if constexpr (indexed) {
+            for (size_t i = first; i < data_.size(); i++) index_.add(data_, i);
+        }
+    }
+
+    [[noreturn]] static void duplicateError(const T& value) {
+        throw std::runtime_error("Duplicate element: " + detail::describeElement(value));
+    }
 };
 
+// ============================================================================
+// STD::PMR VARIANTS
+// ============================================================================
+
+namespace pmr {
+
+template<typename K, typename V, typename KeyConstraint, typename ValueConstraint>
+using ConstrainedMap = meta::ConstrainedMap<K, V, KeyConstraint, ValueConstraint, PmrOrderedStorage>;
+
+template<typename T, typename ElementConstraint>
+using ConstrainedVector = meta::ConstrainedVector<T, ElementConstraint, std::pmr::vector<T>>;
+
+}  // namespace pmr
+
+// Elements stored inside the object, at most N of them
+template<typename T, typename ElementConstraint, size_t N>
+using InlineConstrainedVector = ConstrainedVector<T, ElementConstraint, InlineVector<T, N>>;
+
 // ============================================================================
 // CONSTRAINTS
 // ============================================================================
@@ -82,61 +291,172 @@ struct PositiveConstraint {
     static std::string error(int val) {
         return "Value " + std::to_string(val) + " must be positive";
     }
+
+    // Min-reduction with no early exit vectorises cleanly
+    static bool validate_batch(std::span<const int> vals) {
+        int lowest = 1;
+        for (int v : vals) lowest = std::min(lowest, v);
+        return lowest > 0;
+    }
 };
 
 struct NonEmptyStringConstraint {
-    static bool validate(const std::string& s) { return !s.empty(); }
-    static std::string error(const std::string& s) {
+    static bool validate(std::string_view s) { return !s.empty(); }
+    static std::string error(std::string_view s) {
         return "String cannot be empty";
     }
+
+    static bool validate_batch(std::span<const std::string> vals) {
+        bool ok = true;
+        for (const auto& s : vals) ok &= !s.empty();
+        return ok;
+    }
 };
 
 struct AnyIntConstraint {
     static bool validate(int val) { return true; }
     static std::string error(int val) { return ""; }
+    static bool validate_batch(std::span<const int>) { return true; }
 };
 
 struct AnyStringConstraint {
-    static bool validate(const std::string& s) { return true; }
-    static std::string error(const std::string& s) { return ""; }
+    static bool validate(std::string_view s) { return true; }
+    static std::string error(std::string_view s) { return ""; }
+    static bool validate_batch(std::span<const std::string>) { return true; }
+};
+
+// ============================================================================
+// WHITELIST INDEXES
+// ============================================================================
+
+namespace detail {
+
+struct StringViewHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+// Hashed set of allowed strings. Lookups take a string_view, so callers
+// never have to build a std::string just to ask.
+class StringIndex {
+private:
+    std::unordered_set<std::string, StringViewHash, std::equal_to<>> values_;
+
+public:
+    explicit StringIndex(const std::vector<std::string>& values)
+        : values_(values.begin(), values.end()) {}
+
+    bool contains(std::string_view s) const { return values_.find(s) != values_.end(); }
+
+    template<typename S>
+    bool containsAll(std::span<const S> values) const {
+        for (const auto& v : values) {
+            if (!contains(v)) return false;
+        }
+        return true;
+    }
+};
+
+// Allowed ints. A bitmap over [min, max] when the range is dense enough that
+// it is no bigger than the sorted list would be, otherwise a sorted vector
+// searched with a branchless lower bound.
+class IntIndex {
+private:
+    // Bitmap bits per allowed value before we fall back to the sorted list
+    static constexpr int64_t kMaxBitsPerValue = 32;
+
+    std::vector<int> sorted_;
+    std::vector<uint64_t> bitmap_;
+    int min_ = 0;
+    uint64_t span_ = 0;
+
+    bool inBitmap(int value) const {
+        uint64_t off = static_cast<uint64_t>(static_cast<int64_t>(value) - min_);
+        if (off >= span_) return false;
+        return (bitmap_[off >> 6] >> (off & 63)) & 1;
+    }
+
+    bool inSorted(int value) const {
+        const int* base = sorted_.data();
+        size_t n = sorted_.size();
+        if (n == 0) return false;
+        while (n > 1) {
+            size_t half = n / 2;
+            base = (base[half] <= value) ? base + half : base;
+            n -= half;
+        }
+        return *base == value;
+    }
+
+public:
+    explicit IntIndex(const std::vector<int>& values) : sorted_(values) {
+        std::sort(sorted_.begin(), sorted_.end());
+        sorted_.erase(std::unique(sorted_.begin(), sorted_.end()), sorted_.end());
+        if (sorted_.empty()) return;
+
+        int64_t range = static_cast<int64_t>(sorted_.back()) - sorted_.front() + 1;
+        if (range > static_cast<int64_t>(sorted_.size()) * kMaxBitsPerValue) return;
+
+        min_ = sorted_.front();
+        span_ = static_cast<uint64_t>(range);
+        bitmap_.assign((span_ + 63) / 64, 0);
+        for (int v : sorted_) {
+            uint64_t off = static_cast<uint64_t>(static_cast<int64_t>(v) - min_);
+            bitmap_[off >> 6] |= uint64_t{1} << (off & 63);
+        }
+        sorted_.clear();
+        sorted_.shrink_to_fit();
+    }
+
+    bool contains(int value) const {
+        return bitmap_.empty() ? inSorted(value) : inBitmap(value);
+    }
+
+    bool containsAll(std::span<const int> values) const {
+        // No early exit: the loop body has no branches left to mispredict
+        bool ok = true;
+        if (bitmap_.empty()) {
+            for (int v : values) ok &= inSorted(v);
+        } else {
+            for (int v : values) ok &= inBitmap(v);
+        }
+        return ok;
+    }
 };
 
+}  // namespace detail
+
 // ============================================================================
 // WHITELIST CONSTRAINTS
 // ============================================================================
 
 class StringKeyWhitelist {
 private:
-    std::vector<std::string> allowedKeys_;
+    detail::StringIndex allowedKeys_;
 
 public:
     StringKeyWhitelist(const std::vector<std::string>& keys) : allowedKeys_(keys) {}
 
-    bool validate(const std::string& key) const {
-        for (const auto& allowed : allowedKeys_) {
-            if (key == allowed) return true;
-        }
-        return false;
-    }
+    bool validate(std::string_view key) const { return allowedKeys_.contains(key); }
+
+    bool validateAll(std::span<const std::string> keys) const { return allowedKeys_.containsAll(keys); }
+    bool validateAll(std::span<const std::string_view> keys) const { return allowedKeys_.containsAll(keys); }
 
-    std::string error(const std::string& key) const {
-        return "Key '" + key + "' not in whitelist";
+    std::string error(std::string_view key) const {
+        return "Key '" + std::string(key) + "' not in whitelist";
     }
 };
 
 class IntValueWhitelist {
 private:
-    std::vector<int> allowedValues_;
+    detail::IntIndex allowedValues_;
 
 public:
     IntValueWhitelist(const std::vector<int>& values) : allowedValues_(values) {}
 
-    bool validate(int value) const {
-        for (auto allowed : allowedValues_) {
-            if (value == allowed) return true;
-        }
-        return false;
-    }
+    bool validate(int value) const { return allowedValues_.contains(value); }
+
+    bool validateAll(std::span<const int> values) const { return allowedValues_.containsAll(values); }
 
     std::string error(int value) const {
         return "Value " + std::to_string(value) + " not in whitelist";
@@ -145,20 +465,18 @@ public:
 
 class StringValueWhitelist {
 private:
-    std::vector<std::string> allowedValues_;
+    detail::StringIndex allowedValues_;
 
 public:
     StringValueWhitelist(const std::vector<std::string>& values) : allowedValues_(values) {}
 
-    bool validate(const std::string& value) const {
-        for (const auto& allowed : allowedValues_) {
-            if (value == allowed) return true;
-        }
-        return false;
-    }
+    bool validate(std::string_view value) const { return allowedValues_.contains(value); }
+
+    bool validateAll(std::span<const std::string> values) const { return allowedValues_.containsAll(values); }
+    bool validateAll(std::span<const std::string_view> values) const { return allowedValues_.containsAll(values); }
 
-    std::string error(const std::string& value) const {
-        return "Value '" + value + "' not in whitelist";
+    std::string error(std::string_view value) const {
+        return "Value '" + std::string(value) + "' not in whitelist";
     }
 };
 
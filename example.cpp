@@ -122,12 +122,10 @@ struct ServiceConfig
                                                              meta::StringConstraint{1, 128}),
                    meta::Field<&ServiceConfig::db>("database",
                                                    "Database configuration",
-                                                   meta::RequiredField,
-                                                   "DatabaseConfig"),
+                                                   meta::RequiredField),
                    meta::Field<&ServiceConfig::app>("application",
                                                     "Application configuration",
-                                                    meta::RequiredField,
-                                                    "AppConfig"),
+                                                    meta::RequiredField),
                    meta::Field<&ServiceConfig::features>("features",
                                                          "Enabled features",
                                                          meta::OptionalField,
@@ -13,6 +13,29 @@ struct User {
   };
 };
 
+struct Listener {
+  std::string host;
+  int port = 0;
+  int minWorkers = 1;
+  int maxWorkers = 1;
+
+  static constexpr auto fields = std::tuple{
+    meta::Field<&Listener::host>("host", "Bind address", meta::OptionalField),
+    meta::Field<&Listener::port>("port", "Bind port", meta::OptionalField),
+    meta::Field<&Listener::minWorkers>("min_workers", "Minimum worker threads", meta::OptionalField),
+    meta::Field<&Listener::maxWorkers>("max_workers", "Maximum worker threads", meta::OptionalField)
+  };
+
+  static constexpr auto rules = std::tuple{
+    meta::Rule<&Listener::host, &Listener::port>(
+      [](const std::string& host, const int& port) { return host.empty() || port != 0; },
+      "port is required when host is set"),
+    meta::Rule<&Listener::minWorkers, &Listener::maxWorkers>(
+      [](const int& lo, const int& hi) { return lo <= hi; },
+      "min_workers must not exceed max_workers")
+  };
+};
+
 int main() {
   // Valid YAML
   YAML::Node valid = YAML::Load(R"(
@@ -44,5 +67,24 @@ int main() {
     }
   }
 
+  // Cross-field rules
+  YAML::Node listener = YAML::Load(R"(
+    host: 0.0.0.0
+    min_workers: 8
+    max_workers: 4
+  )");
+
+  auto [l1, result3] = meta::fromYamlWithValidation<Listener>(listener);
+  std::cout << "\n✗ Rules (collect all):\n";
+  for (const auto& [field, msg] : result3.errors) {
+    std::cout << "  " << field << ": " << msg << "\n";
+  }
+
+  auto [l2, result4] = meta::fromYamlWithValidation<Listener, meta::ParseMode::FailFast>(listener);
+  std::cout << "\n✗ Rules (fail fast):\n";
+  for (const auto& [field, msg] : result4.errors) {
+    std::cout << "  " << field << ": " << msg << "\n";
+  }
+
   return 0;
 }
@@ -0,0 +1,106 @@
+#include "meta.h"
+#include "bounded.h"
+#include "extract.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+// ============================================================================
+// NESTED CONFIG
+// ============================================================================
+
+struct DatabaseConfig {
+    std::string host;
+    meta::BoundedInt<1, 65535> port{5432};
+    std::vector<std::string> replicas;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&DatabaseConfig::host>("host", "Database host", meta::RequiredField),
+        meta::Field<&DatabaseConfig::port>("port", "Database port", meta::OptionalField),
+        meta::Field<&DatabaseConfig::replicas>("replicas", "Read replicas", meta::OptionalField)
+    };
+};
+
+struct ServiceConfig {
+    std::string service_name;
+    DatabaseConfig db;
+    std::map<std::string, std::string> routes;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&ServiceConfig::service_name>("service_name", "Service identifier", meta::RequiredField),
+        meta::Field<&ServiceConfig::db>("database", "Database configuration", meta::RequiredField),
+        meta::Field<&ServiceConfig::routes>("routes", "Path to upstream", meta::OptionalField)
+    };
+};
+
+// A config whose bulk comes after the part we want
+std::string makeConfig(size_t routes) {
+    std::string text = "service_name: gateway\n"
+                       "database:\n"
+                       "  host: db1.internal\n"
+                       "  port: 6432\n"
+                       "  replicas: [db2.internal, db3.internal]\n"
+                       "routes:\n";
+    for (size_t i = 0; i < routes; i++) {
+        text += "  /api/v1/resource" + std::to_string(i) + ": http://backend" + std::to_string(i % 16) + ":8080\n";
+    }
+    return text;
+}
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Path Extraction ===\n\n";
+
+    std::string text = makeConfig(200000);
+
+    // ========================================
+    // One value, the rest never parsed
+    // ========================================
+    std::cout << "--- extract<\"database.port\"> ---\n";
+
+    std::istringstream in(text);
+    auto start = std::chrono::steady_clock::now();
+    auto [port, result] = meta::extract<ServiceConfig, "database.port">(in);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    if (port) {
+        std::cout << "✓ port = " << port->value() << " in " << elapsed.count() << " us, read "
+                  << in.tellg() << " of " << text.size() << " bytes\n";
+    }
+
+    start = std::chrono::steady_clock::now();
+    auto full = meta::fromYaml<ServiceConfig>(YAML::Load(text));
+    elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "  (full parse: " << elapsed.count() << " us)\n";
+
+    auto [replicas, result2] = meta::extract<ServiceConfig, "database.replicas">(text);
+    if (replicas) {
+        std::cout << "✓ " << replicas->size() << " replicas, first " << replicas->front() << "\n";
+    }
+
+    // ========================================
+    // Same checks as a full parse
+    // ========================================
+    std::cout << "\n--- Errors ---\n";
+
+    for (std::string_view bad : {"database:\n  port: 70000\n", "service_name: x\n", "database: db1\n"}) {
+        auto [value, errors] = meta::extract<ServiceConfig, "database.port">(bad);
+        for (const auto& [field, msg] : errors.errors) {
+            std::cout << "  ✗ " << field << ": " << msg << "\n";
+        }
+        if (value) std::cout << "  ✓ default port " << value->value() << "\n";
+    }
+
+    auto [host, result3] = meta::extract<ServiceConfig, "database.host">(std::string_view("database: {}"));
+    for (const auto& [field, msg] : result3.errors) {
+        std::cout << "  ✗ " << field << ": " << msg << "\n";
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,310 @@
+#pragma once
+
+#include "meta.h"
+#include "paths.h"
+#include <cstddef>
+#include <istream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
+
+namespace meta {
+
+// ============================================================================
+// EXTRACT - one value out of a document without parsing the rest
+// ============================================================================
+//
+//   auto [port, result] = meta::extract<ServiceConfig, "database.port">(file);
+//
+// The path is resolved against T's (nested) fields at compile time, so a
+// typo does not compile and the result has the member's own type. The
+// input is streamed through yaml-cpp's event parser: mappings off the path
+// are skipped without building nodes, only the target value is
+// materialised, and parsing stops as soon as it is complete (or as soon as
+// the enclosing mapping closes without it). The value then goes through
+// the same checks fromYamlWithValidation applies to that field: its
+// YamlTraits, Field constraint, required/default handling. Cross-field
+// rules are not run, since their other inputs are never read.
+//
+// Aliases inside the extracted value may only refer to anchors defined
+// inside it.
+//
+
+namespace detail {
+
+// Thrown out of the event handler to stop the parser
+struct ExtractStop {};
+
+class PathExtractor : public YAML::EventHandler {
+public:
+    // Where the search ended
+    enum class Outcome { Found, Missing, NotMapping };
+
+    explicit PathExtractor(std::span<const std::string_view> segments) : segments_(segments) {}
+
+    Outcome outcome() const { return outcome_; }
+
+    // Segments leading to the node that is not a mapping (NotMapping only)
+    size_t depthReached() const { return level_ < 0 ? 0 : static_cast<size_t>(level_) + 1; }
+
+    const YAML::Node& value() const { return root_; }
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override { stop(Outcome::Missing); }
+
+    void OnNull(const YAML::Mark&, YAML::anchor_t anchor) override {
+        if (startsCapture()) return add(YAML::Node(YAML::NodeType::Null), anchor);
+        onLeaf();
+    }
+
+    void OnAlias(const YAML::Mark&, YAML::anchor_t anchor) override {
+        if (startsCapture()) {
+            auto it = anchors_.find(anchor);
+            if (it == anchors_.end()) {
+                throw std::runtime_error("alias refers to an anchor outside the extracted value");
+            }
+            return add(it->second, 0);
+        }
+        onLeaf();
+    }
+
+    void OnScalar(const YAML::Mark&, const std::string& tag, YAML::anchor_t anchor,
+                  const std::string& value) override {
+        if (startsCapture()) {
+            YAML::Node node(value);
+            if (!tag.empty() && tag != "?") node.SetTag(tag);
+            return add(node, anchor);
+        }
+        if (skip_ == 0 && level_ >= 0 && expectKey_) {
+            keyMatched_ = value == segments_[static_cast<size_t>(level_)];
+            expectKey_ = false;
+            return;
+        }
+        onLeaf();
+    }
+
+    void OnSequenceStart(const YAML::Mark&, const std::string& tag, YAML::anchor_t anchor,
+                         YAML::EmitterStyle::value) override {
+        onContainerStart(YAML::NodeType::Sequence, tag, anchor);
+    }
+
+    void OnSequenceEnd() override { onContainerEnd(); }
+
+    void OnMapStart(const YAML::Mark&, const std::string& tag, YAML::anchor_t anchor,
+                    YAML::EmitterStyle::value) override {
+        onContainerStart(YAML::NodeType::Map, tag, anchor);
+    }
+
+    void OnMapEnd() override {
+        if (!capturing_ && skip_ == 0) {
+            stop(Outcome::Missing);  // the mapping on the path closed without the key
+        }
+        onContainerEnd();
+    }
+
+private:
+    std::span<const std::string_view> segments_;
+    Outcome outcome_ = Outcome::Missing;
+
+    // Search state: level_ is the depth of the mapping on the path we are
+    // in (-1 before the document root); skip_ counts open containers of a
+    // subtree that is off the path
+    int level_ = -1;
+    size_t skip_ = 0;
+    bool expectKey_ = false;
+    bool keyMatched_ = false;
+
+    // Capture state
+    bool capturing_ = false;
+    YAML::Node root_;
+    std::vector<YAML::Node> open_;
+    std::vector<std::optional<YAML::Node>> pendingKey_;
+    std::unordered_map<YAML::anchor_t, YAML::Node> anchors_;
+
+    [[noreturn]] void stop(Outcome outcome) {
+        outcome_ = outcome;
+        throw ExtractStop{};
+    }
+
+    bool atTarget() const {
+        return skip_ == 0 && level_ >= 0 && !expectKey_ && keyMatched_ &&
+               static_cast<size_t>(level_) + 1 == segments_.size();
+    }
+
+    // True while building the target value, starting with its first event
+    bool startsCapture() {
+        if (!capturing_ && atTarget()) capturing_ = true;
+        return capturing_;
+    }
+
+    // A scalar, null or alias that is a whole node
+    void onLeaf() {
+        if (skip_ > 0) return;
+        if (level_ < 0) stop(Outcome::NotMapping);  // document root is not a mapping
+        if (!expectKey_ && keyMatched_) stop(Outcome::NotMapping);  // path runs through a scalar
+        expectKey_ = !expectKey_;
+    }
+
+    void onContainerStart(YAML::NodeType::value type, const std::string& tag, YAML::anchor_t anchor) {
+        if (startsCapture()) {
+            YAML::Node node(type);
+            if (!tag.empty() && tag != "?" && tag != "!") node.SetTag(tag);
+            add(node, anchor);
+            open_.push_back(node);
+            pendingKey_.emplace_back();
+            return;
+        }
+        if (skip_ > 0) {
+            skip_++;
+            return;
+        }
+        if (level_ < 0) {
+            if (type != YAML::NodeType::Map) stop(Outcome::NotMapping);
+            level_ = 0;
+            expectKey_ = true;
+            return;
+        }
+        if (!expectKey_ && keyMatched_) {
+            if (type != YAML::NodeType::Map) stop(Outcome::NotMapping);
+            level_++;
+            expectKey_ = true;
+            keyMatched_ = false;
+            return;
+        }
+        skip_ = 1;  // a value off the path, or a complex key
+    }
+
+    void onContainerEnd() {
+        if (capturing_) {
+            open_.pop_back();
+            pendingKey_.pop_back();
+            if (open_.empty()) stop(Outcome::Found);
+            return;
+        }
+        if (skip_ > 0 && --skip_ == 0) {
+            keyMatched_ = false;
+            expectKey_ = !expectKey_;
+        }
+    }
+
+    void add(const YAML::Node& node, YAML::anchor_t anchor) {
+        if (anchor != 0) anchors_[anchor] = node;
+        if (open_.empty()) {
+            root_ = node;
+            if (!node.IsMap() && !node.IsSequence()) stop(Outcome::Found);
+            return;
+        }
+        YAML::Node& parent = open_.back();
+        if (parent.IsSequence()) {
+            parent.push_back(node);
+        } else if (auto& key = pendingKey_.back(); !key) {
+            key = node;
+        } else {
+            parent.force_insert(*key, node);
+            key.reset();
+        }
+    }
+};
+
+template<typename Path>
+struct path_split;
+
+template<size_t... P>
+struct path_split<std::index_sequence<P...>> {
+    static constexpr std::array<size_t, sizeof...(P)> indexes{P...};
+    static constexpr size_t last = indexes.back();
+
+    template<size_t... I>
+    static auto parentOf(std::index_sequence<I...>) -> std::index_sequence<indexes[I]...>;
+
+    using parent = decltype(parentOf(std::make_index_sequence<sizeof...(P) - 1>{}));
+};
+
+// Segment names of a path: {"database", "port"}
+template<typename T, size_t... P>
+struct SegmentsOf {
+    static constexpr void write(std::string_view*) {}
+};
+
+template<typename T, size_t I, size_t... Rest>
+struct SegmentsOf<T, I, Rest...> {
+    static constexpr void write(std::string_view* out) {
+        *out = std::get<I>(T::fields).fieldName;
+        SegmentsOf<typename field_at_t<T, I>::type, Rest...>::write(out + 1);
+    }
+};
+
+template<typename T, typename Path>
+struct PathSegments;
+
+template<typename T, size_t... P>
+struct PathSegments<T, std::index_sequence<P...>> {
+    static constexpr auto value = [] {
+        std::array<std::string_view, sizeof...(P)> segments{};
+        SegmentsOf<T, P...>::write(segments.data());
+        return segments;
+    }();
+
+    // Dotted name of the first n segments, as a view of FieldPath's text
+    static constexpr std::string_view prefix(size_t n) {
+        size_t length = n > 0 ? n - 1 : 0;
+        for (size_t i = 0; i < n; i++) length += value[i].size();
+        return FieldPath<T, std::index_sequence<P...>>::value.substr(0, length);
+    }
+};
+
+}  // namespace detail
+
+template<HasFields T, FixedString Path>
+std::pair<std::optional<typename PathTable<T>::template type_at<pathIndex<T, Path>()>>, ValidationResult>
+extract(std::istream& in) {
+    using FullPath = typename PathTable<T>::template path_at<pathIndex<T, Path>()>;
+    using Split = detail::path_split<FullPath>;
+    using Parent = field_path_t<T, typename Split::parent>;
+    constexpr size_t I = Split::last;
+
+    ValidationResult result;
+    using Segments = detail::PathSegments<T, FullPath>;
+    detail::PathExtractor extractor(Segments::value);
+
+    try {
+        YAML::Parser parser(in);
+        parser.HandleNextDocument(extractor);
+    } catch (const detail::ExtractStop&) {
+    } catch (const std::exception& e) {
+        result.addError(Path.view(), std::string("Parse error: ") + e.what());
+        return {std::nullopt, result};
+    }
+
+    // Whatever was found goes through the normal per-field path, wrapped
+    // in a one-key mapping as if it had been read from its parent
+    YAML::Node wrapper(YAML::NodeType::Map);
+    if (extractor.outcome() == detail::PathExtractor::Outcome::NotMapping) {
+        result.addError(Segments::prefix(extractor.depthReached()), "Expected a mapping");
+        return {std::nullopt, result};
+    }
+    if (extractor.outcome() == detail::PathExtractor::Outcome::Found) {
+        wrapper[std::get<I>(Parent::fields).fieldName] = extractor.value();
+    }
+
+    Parent parent{};
+    detail::parseField<T, ParseMode::CollectAll, typename Split::parent, I>(parent, wrapper, result);
+    if (!result.valid) return {std::nullopt, result};
+    return {std::move(parent.*detail::field_at_t<Parent, I>::memberPtr), result};
+}
+
+template<HasFields T, FixedString Path>
+auto extract(std::string_view text) {
+    ViewStreamBuf buffer(text);
+    std::istream in(&buffer);
+    return extract<T, Path>(in);
+}
+
+}  // namespace meta
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// FLAT SET - sorted vector with set semantics
+// ============================================================================
+//
+// Backing container for ConstrainedVector / WhitelistVector when the list
+// is really a set (feature flags, allowed hosts): elements are kept sorted
+// and unique in one contiguous block, and contains() is a binary search.
+// push_back of a value that is already present is a no-op; pair it with
+// UniqueElements to turn that into an error instead.
+//
+
+template<typename T, typename Compare = std::less<>>
+class FlatSet {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using const_reference = const T&;
+    using iterator = typename std::vector<T>::const_iterator;  // elements are not mutable
+    using const_iterator = typename std::vector<T>::const_iterator;
+    using allocator_type = void;  // not allocator-aware
+
+    FlatSet() = default;
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    const T& emplace_back(Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        auto it = lowerBound(value);
+        if (it != data_.end() && !compare_(value, *it)) {
+            return *it;
+        }
+        return *data_.insert(it, std::move(value));
+    }
+
+    // Bulk insert: append, sort the new tail, merge, drop duplicates
+    template<typename It>
+    iterator insert(const_iterator, It first, It last) {
+        size_t oldSize = data_.size();
+        data_.insert(data_.end(), first, last);
+        auto mid = data_.begin() + static_cast<std::ptrdiff_t>(oldSize);
+        std::sort(mid, data_.end(), compare_);
+        std::inplace_merge(data_.begin(), mid, data_.end(), compare_);
+        data_.erase(std::unique(data_.begin(), data_.end(), [this](const T& a, const T& b) {
+            return !compare_(a, b) && !compare_(b, a);
+        }), data_.end());
+        return data_.begin();
+    }
+
+    template<typename Q>
+    bool contains(const Q& value) const {
+        auto it = std::lower_bound(data_.begin(), data_.end(), value, compare_);
+        return it != data_.end() && !compare_(value, *it);
+    }
+
+    void reserve(size_t n) { data_.reserve(n); }
+    void clear() { data_.clear(); }
+
+    const T& operator[](size_t index) const { return data_[index]; }
+
+    size_t size() const { return data_.size(); }
+    bool empty() const { return data_.empty(); }
+
+    const_iterator begin() const { return data_.begin(); }
+    const_iterator end() const { return data_.end(); }
+
+private:
+    std::vector<T> data_;
+    [[no_unique_address]] Compare compare_;
+
+    typename std::vector<T>::iterator lowerBound(const T& value) {
+        return std::lower_bound(data_.begin(), data_.end(), value, compare_);
+    }
+};
+
+}  // namespace meta
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace meta {
+
+// ============================================================================
+// GENERATOR - minimal coroutine input range (std::generator is C++23)
+// ============================================================================
+//
+//   meta::Generator<int> count(int n) {
+//       for (int i = 0; i < n; i++) co_yield i;
+//   }
+//
+//   for (int i : count(3)) { ... }
+//
+// Single pass: begin() starts the coroutine, each ++ resumes it up to the
+// next co_yield. *it refers to the yielded object, which stays alive until
+// the iterator is advanced, so it may be moved from. Exceptions thrown in
+// the coroutine are rethrown from begin() / ++.
+//
+
+template<typename T>
+class Generator {
+public:
+    using value_type = std::remove_cvref_t<T>;
+    using reference = value_type&;
+
+    struct promise_type {
+        value_type* current = nullptr;
+        std::exception_ptr exception;
+
+        Generator get_return_object() {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        // The yielded object lives in the coroutine frame across the suspension
+        std::suspend_always yield_value(value_type& value) noexcept {
+            current = std::addressof(value);
+            return {};
+        }
+
+        std::suspend_always yield_value(value_type&& value) noexcept {
+            current = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept {}
+        void unhandled_exception() { exception = std::current_exception(); }
+
+        // Coroutines only yield; co_await inside one is a mistake
+        template<typename U>
+        std::suspend_never await_transform(U&&) = delete;
+    };
+
+    class iterator {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = Generator::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+        reference operator*() const { return *handle_.promise().current; }
+        value_type* operator->() const { return handle_.promise().current; }
+
+        iterator& operator++() {
+            resume(handle_);
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const { return !handle_ || handle_.done(); }
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    Generator(Generator&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() {
+        if (handle_) handle_.destroy();
+    }
+
+    iterator begin() {
+        resume(handle_);
+        return iterator(handle_);
+    }
+
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit Generator(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    static void resume(std::coroutine_handle<promise_type> handle) {
+        handle.resume();
+        if (handle.promise().exception) {
+            std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+        }
+    }
+};
+
+}  // namespace meta
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace meta {
+
+// ============================================================================
+// INLINE STRING - up to N chars stored inside the object
+// ============================================================================
+//
+// Fixed-capacity string used as BoundedString's storage when MaxLen is small
+// (see kInlineStringMaxLen). The characters live in the object next to a
+// one- or two-byte length, so a record full of names and hostnames carries
+// no heap pointers. Not null-terminated; use view() / str().
+//
+
+template<size_t N>
+class InlineString {
+public:
+    using value_type = char;
+    using size_type = size_t;
+    using iterator = char*;
+    using const_iterator = const char*;
+    using allocator_type = void;  // not allocator-aware
+
+    static constexpr size_t static_capacity = N;
+
+    constexpr InlineString() = default;
+
+    constexpr InlineString(size_t count, char c) {
+        checkFits(count);
+        std::fill_n(data_, count, c);
+        size_ = static_cast<size_storage>(count);
+    }
+
+    constexpr explicit InlineString(std::string_view s) { assign(s); }
+
+    constexpr InlineString& assign(std::string_view s) {
+        checkFits(s.size());
+        std::copy(s.begin(), s.end(), data_);
+        size_ = static_cast<size_storage>(s.size());
+        return *this;
+    }
+
+    constexpr InlineString& operator=(std::string_view s) { return assign(s); }
+
+    constexpr size_t size() const { return size_; }
+    constexpr size_t length() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    constexpr const char* data() const { return data_; }
+    constexpr char* data() { return data_; }
+
+    constexpr iterator begin() { return data_; }
+    constexpr iterator end() { return data_ + size_; }
+    constexpr const_iterator begin() const { return data_; }
+    constexpr const_iterator end() const { return data_ + size_; }
+
+    constexpr std::string_view view() const { return std::string_view(data_, size_); }
+    constexpr operator std::string_view() const { return view(); }
+    std::string str() const { return std::string(view()); }
+
+    friend constexpr bool operator==(const InlineString& a, const InlineString& b) {
+        return a.view() == b.view();
+    }
+    friend constexpr bool operator==(const InlineString& a, std::string_view b) {
+        return a.view() == b;
+    }
+
+private:
+    using size_storage = std::conditional_t<(N <= UINT8_MAX), uint8_t,
+                         std::conditional_t<(N <= UINT16_MAX), uint16_t, uint32_t>>;
+
+    char data_[N] = {};
+    size_storage size_ = 0;
+
+    static constexpr void checkFits(size_t n) {
+        if (n > N) {
+            throw std::length_error("InlineString capacity exceeded");
+        }
+    }
+};
+
+// Largest MaxLen for which BoundedString stores its characters inline:
+// InlineString<63> is 64 bytes, one cache line. Longer bounds (hostnames,
+// paths) default to std::string, which is 32 bytes whatever the bound; pass
+// InlineString<N> as BoundedString's String argument to keep them inline.
+inline constexpr size_t kInlineStringMaxLen = 63;
+
+template<size_t MaxLen>
+using default_string_storage_t =
+    std::conditional_t<(MaxLen > 0 && MaxLen <= kInlineStringMaxLen), InlineString<MaxLen>, std::string>;
+
+}  // namespace meta
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace meta {
+
+// ============================================================================
+// INLINE VECTOR - fixed capacity, elements stored inside the object
+// ============================================================================
+//
+// Drop-in backing container for ConstrainedVector / WhitelistVector and the
+// storage behind BoundedVector. Capacity is a compile-time constant, so a
+// struct holding an InlineVector<std::string, 5> carries its elements with
+// it and never touches the heap for the vector itself. Growing past N
+// throws std::length_error.
+//
+
+template<typename T, size_t N>
+class InlineVector {
+    static_assert(N > 0, "InlineVector needs a non-zero capacity");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using allocator_type = void;  // not allocator-aware
+
+    static constexpr size_t static_capacity = N;
+
+    InlineVector() = default;
+
+    InlineVector(const InlineVector& other) {
+        std::uninitialized_copy(other.begin(), other.end(), data());
+        size_ = other.size_;
+    }
+
+    InlineVector(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        std::uninitialized_move(other.begin(), other.end(), data());
+        size_ = other.size_;
+        other.clear();
+    }
+
+    InlineVector& operator=(const InlineVector& other) {
+        if (this != &other) {
+            clear();
+            std::uninitialized_copy(other.begin(), other.end(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    InlineVector& operator=(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            std::uninitialized_move(other.begin(), other.end(), data());
+            size_ = other.size_;
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~InlineVector() { clear(); }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == N) {
+            throw std::length_error("InlineVector capacity exceeded");
+        }
+        T* slot = std::construct_at(data() + size_, std::forward<Args>(args)...);
+        size_++;
+        return *slot;
+    }
+
+    // Appends [first, last) before pos; all-or-nothing on capacity
+    template<typename It>
+    iterator insert(const_iterator pos, It first, It last) {
+        size_t offset = static_cast<size_t>(pos - begin());
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count > N - size_) {
+            throw std::length_error("InlineVector capacity exceeded");
+        }
+        size_t oldSize = size_;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        std::rotate(begin() + offset, begin() + oldSize, end());
+        return begin() + offset;
+    }
+
+    void pop_back() {
+        size_--;
+        std::destroy_at(data() + size_);
+    }
+
+    void clear() {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    // Nothing to allocate; only checks the request fits
+    void reserve(size_t n) const {
+        if (n > N) {
+            throw std::length_error("InlineVector capacity exceeded");
+        }
+    }
+
+    T& operator[](size_t index) { return data()[index]; }
+    const T& operator[](size_t index) const { return data()[index]; }
+
+    T& at(size_t index) {
+        if (index >= size_) throw std::out_of_range("InlineVector::at");
+        return data()[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size_) throw std::out_of_range("InlineVector::at");
+        return data()[index];
+    }
+
+    T& front() { return data()[0]; }
+    const T& front() const { return data()[0]; }
+    T& back() { return data()[size_ - 1]; }
+    const T& back() const { return data()[size_ - 1]; }
+
+    T* data() { return reinterpret_cast<T*>(storage_); }
+    const T* data() const { return reinterpret_cast<const T*>(storage_); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    static constexpr size_t capacity() { return N; }
+    static constexpr size_t max_size() { return N; }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+
+private:
+    // Smallest counter that can hold N
+    using size_storage = std::conditional_t<(N <= UINT8_MAX), uint8_t,
+                         std::conditional_t<(N <= UINT16_MAX), uint16_t, uint32_t>>;
+
+    alignas(T) std::byte storage_[N * sizeof(T)];
+    size_storage size_ = 0;
+};
+
+}  // namespace meta
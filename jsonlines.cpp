@@ -0,0 +1,134 @@
+#include "meta.h"
+#include "bounded.h"
+#include "jsonlines.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <map>
+#include <unistd.h>
+
+// ============================================================================
+// RECORD TYPE
+// ============================================================================
+
+struct Order {
+    std::string id;
+    std::string customer;
+    meta::BoundedInt<1, 1000> quantity{1};
+    double total = 0;
+    bool shipped = false;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Order::id>("id", "Order id", meta::RequiredField),
+        meta::Field<&Order::customer>("customer", "Customer name", meta::RequiredField),
+        meta::Field<&Order::quantity>("quantity", "Items ordered", meta::RequiredField),
+        meta::Field<&Order::total>("total", "Order total", meta::RequiredField),
+        meta::Field<&Order::shipped>("shipped", "Left the warehouse", meta::OptionalField)
+    };
+};
+
+// Floating-point readings, list and map fields
+struct Sample {
+    std::string sensor;
+    double reading = 0;
+    std::vector<std::string> tags;
+    meta::BoundedVector<meta::BoundedString<1, 64>, 0, 3> backups;
+    std::map<std::string, std::string> limits;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Sample::sensor>("sensor", "Sensor id", meta::RequiredField),
+        meta::Field<&Sample::reading>("reading", "Last reading", meta::RequiredField),
+        meta::Field<&Sample::tags>("tags", "Labels", meta::OptionalField),
+        meta::Field<&Sample::backups>("backups", "Fallback sensors", meta::OptionalField),
+        meta::Field<&Sample::limits>("limits", "Alarm limits", meta::OptionalField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== JSON Lines Export ===\n\n";
+
+    std::vector<Order> orders;
+    orders.reserve(500000);
+    for (int i = 0; i < 500000; i++) {
+        orders.push_back({"ord-" + std::to_string(i), i % 7 == 0 ? "O'Brien \"Bob\"" : "alice",
+                          1 + i % 1000, i * 1.25, i % 3 == 0});
+    }
+
+    // ========================================
+    // Straight to a file descriptor
+    // ========================================
+    std::cout << "--- To stdout ---\n" << std::flush;
+    meta::toJsonLines(std::span<const Order>(orders).first(3), STDOUT_FILENO);
+
+    std::cout << "\n--- To a file ---\n";
+    const char* path = "jsonlines_demo.jsonl";
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::perror(path);
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t bytes = meta::toJsonLines(orders, fd);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    ::close(fd);
+    std::cout << "✓ " << orders.size() << " records, " << bytes / 1024 << " KiB in " << elapsed.count() << " ms\n";
+
+    // Same bytes as encoding one record at a time
+    size_t expected = 0;
+    for (const auto& order : orders) expected += meta::toJsonLine(order).size();
+    std::cout << (expected == bytes ? "✓" : "✗") << " matches toJsonLine byte for byte in length\n";
+    std::remove(path);
+
+    // ========================================
+    // Numbers and lists
+    // ========================================
+    std::cout << "\n--- Numbers and lists ---\n";
+    Sample sample = *meta::fromYaml<Sample>(YAML::Load(R"(
+        sensor: t1
+        reading: 1.5
+        tags: [roof, "north \"wing\""]
+        backups: [t2, t3]
+        limits: {"max=40,min": "-5", "unit\"": "C"}
+    )"));
+    const std::string rest =
+        R"(,"tags":["roof","north \"wing\""],"backups":["t2","t3"],"limits":{"max=40,min":"-5","unit\"":"C"}})";
+    std::pair<double, std::string> readings[] = {
+        {1.5, R"({"sensor":"t1","reading":1.5)" + rest},
+        {1e-9, R"({"sensor":"t1","reading":1e-09)" + rest},
+        {NAN, R"({"sensor":"t1","reading":null)" + rest},
+        {-INFINITY, R"({"sensor":"t1","reading":null)" + rest},
+    };
+    for (const auto& [reading, expected] : readings) {
+        sample.reading = reading;
+        std::string line = meta::toJsonLine(sample);
+        line.pop_back();
+        std::cout << (line == expected ? "✓ " : "✗ ") << line << "\n";
+    }
+    sample.tags.clear();
+    sample.backups = {};
+    sample.limits.clear();
+    std::string empty = meta::toJsonLine(sample);
+    std::cout << (empty == R"({"sensor":"t1","reading":null,"tags":[],"backups":[],"limits":{}})" "\n" ? "✓ " : "✗ ")
+              << empty;
+
+    // ========================================
+    // Write errors are reported
+    // ========================================
+    std::cout << "\n--- Closed descriptor ---\n";
+    try {
+        meta::toJsonLines(orders, fd);
+    } catch (const std::runtime_error& e) {
+        std::cout << "✗ " << e.what() << "\n";
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
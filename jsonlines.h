@@ -0,0 +1,170 @@
+#pragma once
+
+#include "meta.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <sys/uio.h>
+#include <thread>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// JSON LINES EXPORT - parallel encoding, ordered writev
+// ============================================================================
+//
+//   int fd = open("users.jsonl", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+//   size_t bytes = meta::toJsonLines(std::span<const User>(users), fd);
+//
+// Records are cut into chunks; worker threads encode whole chunks with
+// appendJson into their own buffers while the calling thread writes
+// finished chunks to fd, in record order, with one writev per run of
+// ready chunks. Nothing is ever concatenated into one big string, and
+// workers stay at most a few chunks ahead of the writer, so memory is
+// bounded by the window rather than the export size.
+//
+// Write errors (and exceptions thrown while encoding) stop the export and
+// are rethrown; what had been written by then stays written.
+//
+
+struct JsonLinesOptions {
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t chunkRecords = 4096;
+};
+
+namespace detail {
+
+struct JsonChunk {
+    std::string text;
+    std::atomic<bool> ready{false};
+};
+
+// Writes every byte of iov[0..count); 0 or the errno that stopped it
+inline int writeAll(int fd, iovec* iov, int count) {
+    while (count > 0) {
+        ssize_t wrote = ::writev(fd, iov, count);
+        if (wrote < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+        auto left = static_cast<size_t>(wrote);
+        while (count > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+            iov->iov_len -= left;
+        }
+    }
+    return 0;
+}
+
+}  // namespace detail
+
+// Returns the number of bytes written
+template<HasFields T>
+size_t toJsonLines(std::span<const T> records, int fd, JsonLinesOptions options = {}) {
+    const size_t chunkRecords = std::max<size_t>(options.chunkRecords, 1);
+    const size_t chunks = (records.size() + chunkRecords - 1) / chunkRecords;
+    if (chunks == 0) return 0;
+    const size_t threads = std::clamp<size_t>(options.threads, 1, chunks);
+    const size_t window = threads * 2;  // chunks a worker may run ahead of the writer
+
+    auto slots = std::make_unique<detail::JsonChunk[]>(chunks);
+    std::atomic<size_t> claimed{0};
+    std::atomic<size_t> flushed{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr encodeError;
+    std::mutex errorMutex;
+
+    // Every claimed chunk is marked ready, encoded or not, so the writer
+    // never waits on a chunk nobody will produce
+    auto encode = [&] {
+        for (size_t k; (k = claimed.fetch_add(1, std::memory_order_relaxed)) < chunks;) {
+            for (size_t done = flushed.load(std::memory_order_acquire);
+                 k >= done + window && !failed.load(std::memory_order_relaxed);
+                 done = flushed.load(std::memory_order_acquire)) {
+                flushed.wait(done, std::memory_order_acquire);
+            }
+            if (!failed.load(std::memory_order_relaxed)) {
+                try {
+                    std::string& out = slots[k].text;
+                    size_t end = std::min(records.size(), (k + 1) * chunkRecords);
+                    for (size_t i = k * chunkRecords; i < end; i++) {
+                        appendJson(out, records[i]);
+                        out += '\n';
+                    }
+                } catch (...) {
+                    std::lock_guard lock(errorMutex);
+                    if (!encodeError) encodeError = std::current_exception();
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            slots[k].ready.store(true, std::memory_order_release);
+            slots[k].ready.notify_one();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; i++) workers.emplace_back(encode);
+
+    size_t bytes = 0;
+    int writeError = 0;
+    std::vector<iovec> iov;
+    for (size_t next = 0; next < chunks && !failed.load(std::memory_order_relaxed);) {
+        slots[next].ready.wait(false, std::memory_order_acquire);
+        if (failed.load(std::memory_order_relaxed)) break;
+
+        // This chunk and whatever follows it that is already done
+        size_t end = next + 1;
+        while (end < chunks && end - next < IOV_MAX && slots[end].ready.load(std::memory_order_acquire)) end++;
+        iov.clear();
+        size_t batchBytes = 0;
+        for (size_t k = next; k < end; k++) {
+            iov.push_back({slots[k].text.data(), slots[k].text.size()});
+            batchBytes += slots[k].text.size();
+        }
+
+        writeError = detail::writeAll(fd, iov.data(), static_cast<int>(iov.size()));
+        if (writeError != 0) {
+            failed.store(true, std::memory_order_relaxed);
+            break;
+        }
+        bytes += batchBytes;
+        for (size_t k = next; k < end; k++) std::string().swap(slots[k].text);
+        next = end;
+        flushed.store(next, std::memory_order_release);
+        flushed.notify_all();
+    }
+
+    if (failed.load(std::memory_order_relaxed)) {
+        flushed.store(chunks, std::memory_order_release);  // release workers waiting on the window
+        flushed.notify_all();
+    }
+    for (auto& worker : workers) worker.join();
+
+    if (encodeError) std::rethrow_exception(encodeError);
+    if (writeError != 0) {
+        throw std::runtime_error(std::string("toJsonLines: write failed: ") + std::strerror(writeError));
+    }
+    return bytes;
+}
+
+template<HasFields T>
+size_t toJsonLines(const std::vector<T>& records, int fd, JsonLinesOptions options = {}) {
+    return toJsonLines(std::span<const T>(records), fd, options);
+}
+
+}  // namespace meta
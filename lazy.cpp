@@ -0,0 +1,94 @@
+#include "meta.h"
+#include "bounded.h"
+#include "lazy.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// CONFIG WITH A RARELY READ SECTION
+// ============================================================================
+
+struct Listener {
+    std::string host;
+    meta::BoundedInt<1, 65535> port{8080};
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Listener::host>("host", "Bind address", meta::RequiredField),
+        meta::Field<&Listener::port>("port", "Bind port", meta::OptionalField)
+    };
+};
+
+struct Gateway {
+    Listener listen;
+    std::string admin_token;
+    meta::LazyField<std::map<std::string, std::string>> routes;
+    meta::LazyField<meta::BoundedInt<1, 1000>> max_inflight;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Gateway::listen>("listen", "Listener", meta::RequiredField),
+        meta::Field<&Gateway::admin_token>("admin_token", "Admin API token", meta::RequiredField),
+        meta::Field<&Gateway::routes>("routes", "Path to upstream", meta::OptionalField),
+        meta::Field<&Gateway::max_inflight>("max_inflight", "Request limit", meta::OptionalField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Lazy Fields ===\n\n";
+
+    YAML::Node yaml = YAML::Load(R"(
+        listen:
+          host: 0.0.0.0
+          port: 8443
+        routes:
+          /api: http://backend:8080
+          /static: http://cdn:80
+        max_inflight: 5000
+    )");
+
+    // ========================================
+    // Parse only what startup needs
+    // ========================================
+    std::cout << "--- FieldMask ---\n";
+
+    constexpr auto startup = meta::FieldMask<Gateway>::of<&Gateway::listen, &Gateway::routes>();
+    static_assert(startup.count() == 2);
+
+    // admin_token is required but outside the mask, so it is not checked
+    auto [gateway, result] = meta::fromYamlWithValidation<Gateway>(yaml, startup);
+    if (gateway) {
+        std::cout << "✓ listen " << gateway->listen.host << ":" << gateway->listen.port.value() << "\n";
+        std::cout << "  routes decoded yet: " << (gateway->routes.isLoaded() ? "yes" : "no") << "\n";
+    }
+
+    // ========================================
+    // Decoded once, on first use
+    // ========================================
+    std::cout << "\n--- LazyField ---\n";
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&] { gateway->routes.get(); });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    std::cout << "✓ " << gateway->routes->size() << " routes, /api -> " << gateway->routes->at("/api") << "\n";
+
+    // Out of the mask: left as T{} (an empty LazyField decodes to U{})
+    std::cout << "  max_inflight (masked out): " << gateway->max_inflight->value() << "\n";
+
+    // Errors show up on access, not at startup
+    auto full = meta::fromYaml<Gateway>(yaml);
+    const auto& check = full->max_inflight.validate();
+    for (const auto& [field, msg] : check.errors) {
+        std::cout << "  ✗ max_inflight: " << msg << "\n";
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
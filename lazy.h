@@ -0,0 +1,124 @@
+#pragma once
+
+#include "meta.h"
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace meta {
+
+// ============================================================================
+// LAZY FIELDS - decode a member on first access
+// ============================================================================
+//
+// For sections that are large but rarely read:
+//
+//   struct Gateway {
+//       Listener listen;
+//       meta::LazyField<RouteTable> routes;   // only kept as a node
+//       ...
+//   };
+//
+//   const RouteTable& table = gateway.routes.get();   // decoded here, once
+//
+// Parsing only keeps a handle to the field's node (which keeps the
+// document it came from alive). The first get() / validate() decodes it
+// through the usual YamlTraits; concurrent first accesses decode once and
+// the others wait. A missing field decodes to U{}. Problems found while
+// decoding are reported by validate(); get() throws std::runtime_error
+// for an invalid value. Assigning a new node must not race with readers.
+//
+
+template<typename U>
+class LazyField {
+public:
+    using value_type = U;
+
+    LazyField() = default;
+
+    explicit LazyField(const YAML::Node& node) : node_(node), hasNode_(true) {}
+
+    // Copies share the node but decode on their own
+    LazyField(const LazyField& other) : node_(other.node_), hasNode_(other.hasNode_) {}
+
+    LazyField& operator=(const LazyField& other) {
+        if (this != &other) assign(other.node_, other.hasNode_);
+        return *this;
+    }
+
+    void assign(const YAML::Node& node) { assign(node, true); }
+
+    bool isLoaded() const { return loaded_.load(std::memory_order_acquire); }
+    bool hasNode() const { return hasNode_; }
+    const YAML::Node& node() const { return node_; }
+
+    const ValidationResult& validate() const {
+        load();
+        return result_;
+    }
+
+    const U& get() const {
+        const ValidationResult& result = validate();
+        if (!result.valid) {
+            const auto& [field, message] = result.errors.front();
+            throw std::runtime_error(field.empty() ? message : field + ": " + message);
+        }
+        return value_;
+    }
+
+    const U& operator*() const { return get(); }
+    const U* operator->() const { return &get(); }
+
+private:
+    YAML::Node node_;
+    bool hasNode_ = false;
+
+    mutable std::atomic<bool> loaded_{false};
+    mutable std::mutex mutex_;
+    mutable U value_{};
+    mutable ValidationResult result_;
+
+    void assign(const YAML::Node& node, bool hasNode) {
+        std::lock_guard lock(mutex_);
+        node_ = node;
+        hasNode_ = hasNode;
+        value_ = U{};
+        result_ = ValidationResult();
+        loaded_.store(false, std::memory_order_release);
+    }
+
+    void load() const {
+        if (loaded_.load(std::memory_order_acquire)) return;
+
+        std::lock_guard lock(mutex_);
+        if (loaded_.load(std::memory_order_relaxed)) return;
+
+        if (hasNode_) {
+            try {
+                result_ = dispatchParse(value_, node_);
+            } catch (const std::exception& e) {
+                result_.addError("", std::string("Parse error: ") + e.what());
+            } catch (...) {
+                result_.addError("", "Unknown parse error");
+            }
+        }
+        loaded_.store(true, std::memory_order_release);
+    }
+};
+
+template<typename U>
+struct YamlTraits<LazyField<U>> {
+    using type = LazyField<U>;
+
+    static void parse(LazyField<U>& field, const YAML::Node& node) {
+        field.assign(node);
+    }
+
+    static std::string toString(const LazyField<U>& field) {
+        return field.validate().valid ? dispatchToString(field.get()) : "<invalid>";
+    }
+};
+
+}  // namespace meta
@@ -2,7 +2,12 @@
 
 #include "meta.h"
 #include <array>
+#include <concepts>
+#include <memory_resource>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <map>
 #include <stdexcept>
 
@@ -12,13 +17,46 @@ namespace meta {
 // CONTAINERS MAP - Primary template (size inferred by compiler)
 // ============================================================================
 
-template<typename K, typename V, const auto& AllowedKeys>
+template<typename K, typename V, const auto& AllowedKeys, typename Container = std::map<K, V>>
 class ContainersMap {
 public:
     using key_type = K;
     using mapped_type = V;
+    using allocator_type = allocator_of_t<Container>;
+
+    ContainersMap() = default;
+
+    template<typename Alloc>
+        requires std::constructible_from<Container, const Alloc&>
+    explicit ContainersMap(const Alloc& alloc) : data_(alloc) {}
     
     void insert(const K& key, const V& value) {
+        checkKey(key);
+        data_[key] = value;
+    }
+
+    void insert(K&& key, V&& value) {
+        checkKey(key);
+        data_.insert_or_assign(std::move(key), std::move(value));
+    }
+
+    size_t size() const { return data_.size(); }
+    
+    auto begin() { return data_.begin(); }
+    auto end() { return data_.end(); }
+    auto begin() const { return data_.begin(); }
+    auto end() const { return data_.end(); }
+
+    allocator_type get_allocator() const
+        requires(!std::is_void_v<allocator_type>)
+    {
+        return data_.get_allocator();
+    }
+
+private:
+    Container data_;
+
+    static void checkKey(const K& key) {
         // Validate key
         bool found = false;
         for (const auto& allowed : AllowedKeys) {
@@ -29,7 +67,7 @@ public:
         }
         
         if (!found) {
-            std::string msg = "Key '" + key + "' not allowed. Valid keys: {";
+            std::string msg = "Key '" + std::string(std::string_view(key)) + "' not allowed. Valid keys: {";
             for (size_t i = 0; i < AllowedKeys.size(); i++) {
                 if (i > 0) msg += ", ";
                 msg += std::string(AllowedKeys[i]);
@@ -37,46 +75,42 @@ public:
             msg += "}";
             throw std::runtime_error(msg);
         }
-        
-        data_[key] = value;
     }
-
-    size_t size() const { return data_.size(); }
-    
-    auto begin() { return data_.begin(); }
-    auto end() { return data_.end(); }
-    auto begin() const { return data_.begin(); }
-    auto end() const { return data_.end(); }
-
-private:
-    std::map<K, V> data_;
 };
 
 // ============================================================================
 // REGISTER CONTAINERS MAP WITH FRAMEWORK
 // ============================================================================
 
-template<typename K, typename V, const auto& AllowedKeys>
-struct YamlTraits<ContainersMap<K, V, AllowedKeys>> {
-    using type = ContainersMap<K, V, AllowedKeys>;
+template<typename K, typename V, const auto& AllowedKeys, typename Container>
+struct YamlTraits<ContainersMap<K, V, AllowedKeys, Container>> {
+    using type = ContainersMap<K, V, AllowedKeys, Container>;
     
-    static void parse(ContainersMap<K, V, AllowedKeys>& obj, const YAML::Node& node) {
+    static void parse(ContainersMap<K, V, AllowedKeys, Container>& obj, const YAML::Node& node) {
         if (!node.IsMap()) {
             throw std::runtime_error("Expected map node for ContainersMap");
         }
         for (const auto& entry : node) {
-            K key = entry.first.as<K>();
-            V value = entry.second.as<V>();
-            obj.insert(key, value);  // Validates key automatically
+            // Allocator-aware keys and values are decoded with the map's
+            // allocator, then moved in
+            if constexpr (std::is_void_v<allocator_of_t<Container>>) {
+                K key = nodeAs<K>(entry.first);
+                V value = nodeAs<V>(entry.second);
+                obj.insert(std::move(key), std::move(value));  // Validates key automatically
+            } else {
+                K key = nodeAs<K>(entry.first, obj.get_allocator());
+                V value = nodeAs<V>(entry.second, obj.get_allocator());
+                obj.insert(std::move(key), std::move(value));
+            }
         }
     }
     
-    static std::string toString(const ContainersMap<K, V, AllowedKeys>& obj) {
+    static std::string toString(const ContainersMap<K, V, AllowedKeys, Container>& obj) {
         std::string result = "{";
         bool first = true;
         for (const auto& [k, v] : obj) {
             if (!first) result += ", ";
-            result += std::string(k) + "=" + std::string(v);
+            result.append(std::string_view(k)).append("=").append(std::string_view(v));
             first = false;
         }
         result += "}";
@@ -84,4 +118,15 @@ struct YamlTraits<ContainersMap<K, V, AllowedKeys>> {
     }
 };
 
+// ============================================================================
+// STD::PMR VARIANT
+// ============================================================================
+
+namespace pmr {
+
+template<typename K, typename V, const auto& AllowedKeys>
+using ContainersMap = meta::ContainersMap<K, V, AllowedKeys, std::pmr::map<K, V>>;
+
+}  // namespace pmr
+
 }  // namespace meta
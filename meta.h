@@ -9,10 +9,19 @@
 #include <yaml-cpp/yaml.h>
 #include <type_traits>
 #include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
 #include <cstdint>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <ranges>
+#include <streambuf>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 
@@ -131,10 +140,49 @@ concept HasFields = requires(T t) {
     { T::fields };
 };
 
+// A HasFields member is parsed as a nested mapping unless it brings its own
+// YamlTraits
+template <typename T>
+concept NestedFields = HasFields<T> && !HasYamlTraits<T>;
+
+// Types that can say whether their current value is acceptable
+// (BoundedInt, BoundedString, ...)
+template <typename T>
+concept SelfValidating = requires(const T& v) {
+    { v.isValid() } -> std::convertible_to<bool>;
+};
+
 // ============================================================================
 // UTILITIES
 // ============================================================================
 
+// String literal usable as a template argument: PatternConstraint<"[a-z]+">
+template <size_t N> struct FixedString
+{
+    char data[N]{};
+
+    constexpr FixedString(const char (&s)[N])
+    {
+        for (size_t i = 0; i < N; i++)
+            data[i] = s[i];
+    }
+
+    constexpr std::string_view view() const { return std::string_view(data, N - 1); }
+    constexpr size_t size() const { return N - 1; }
+};
+
+// Read-only streambuf over memory the caller owns, so text can be handed to
+// yaml-cpp as a stream without copying it into a stringstream
+class ViewStreamBuf : public std::streambuf
+{
+public:
+    explicit ViewStreamBuf(std::string_view text)
+    {
+        char* begin = const_cast<char*>(text.data());
+        setg(begin, begin, begin + text.size());
+    }
+};
+
 enum class FieldType : uint8_t
 {
     String,
@@ -163,8 +211,56 @@ template <typename MemberPtr> struct member_pointer_traits;
 template <typename T, typename Class> struct member_pointer_traits<T Class::*>
 {
     using type = T;
+    using class_type = Class;
+};
+
+// allocator_type of a container, or void if it has none
+template <typename C, typename = void> struct allocator_of
+{
+    using type = void;
+};
+
+template <typename C> struct allocator_of<C, std::void_t<typename C::allocator_type>>
+{
+    using type = typename C::allocator_type;
 };
 
+template <typename C> using allocator_of_t = typename allocator_of<C>::type;
+
+// Decode a scalar; yaml-cpp has no converters for std::pmr strings, so those
+// are built straight from the scalar text
+template <typename T> T nodeAs(const YAML::Node& node)
+{
+    if constexpr (std::is_same_v<T, std::pmr::string>)
+    {
+        if (!node.IsScalar())
+            throw YAML::TypedBadConversion<std::string>(node.Mark());
+        return T(node.Scalar());
+    }
+    else
+    {
+        return node.template as<T>();
+    }
+}
+
+// As above, but a pmr string is built with alloc, so an element decoded for
+// a container bound to an arena is allocated from that arena, not the
+// default resource
+template <typename T, typename Alloc> T nodeAs(const YAML::Node& node, const Alloc& alloc)
+{
+    if constexpr (std::is_same_v<T, std::pmr::string> &&
+                  std::is_convertible_v<const Alloc&, std::pmr::string::allocator_type>)
+    {
+        if (!node.IsScalar())
+            throw YAML::TypedBadConversion<std::string>(node.Mark());
+        return T(node.Scalar(), typename T::allocator_type(alloc));
+    }
+    else
+    {
+        return nodeAs<T>(node);
+    }
+}
+
 struct ValidationResult
 {
     bool valid = true;
@@ -175,6 +271,21 @@ struct ValidationResult
         valid = false;
         errors.push_back({std::string(fieldName), std::string(message)});
     }
+
+    // Errors reported by a member's traits, re-keyed under that member's name
+    void mergeErrors(std::string_view fieldName, const ValidationResult& other)
+    {
+        if (other.valid)
+            return;
+        valid = false;
+        for (const auto& [errField, errMsg] : other.errors)
+        {
+            if (errField.empty())
+                errors.push_back({std::string(fieldName), errMsg});
+            else
+                errors.push_back({std::string(fieldName) + "." + errField, errMsg});
+        }
+    }
 };
 
 // ============================================================================
@@ -279,16 +390,106 @@ template <> struct YamlTraits<std::vector<std::string>>
     }
 };
 
+// ============================================================================
+// STD::PMR TYPES - allocate from the resource the member was bound to
+// ============================================================================
+
+template <> struct YamlTraits<std::pmr::string>
+{
+    using type = std::pmr::string;
+    static void parse(std::pmr::string& obj, const YAML::Node& node)
+    {
+        if (!node.IsScalar())
+            throw YAML::TypedBadConversion<std::string>(node.Mark());
+        obj.assign(node.Scalar());
+    }
+    static std::string toString(const std::pmr::string& obj)
+    {
+        return std::string(std::string_view(obj));
+    }
+};
+
+template <> struct YamlTraits<std::pmr::vector<std::pmr::string>>
+{
+    using type = std::pmr::vector<std::pmr::string>;
+    static void parse(std::pmr::vector<std::pmr::string>& obj, const YAML::Node& node)
+    {
+        if (!node.IsSequence())
+            throw YAML::TypedBadConversion<std::vector<std::string>>(node.Mark());
+        obj.clear();
+        obj.reserve(node.size());
+        for (const auto& item : node)
+        {
+            if (!item.IsScalar())
+                throw YAML::TypedBadConversion<std::string>(item.Mark());
+            obj.emplace_back(item.Scalar());
+        }
+    }
+    static std::string toString(const std::pmr::vector<std::pmr::string>& obj)
+    {
+        std::string result;
+        bool first = true;
+        for (const auto& item : obj)
+        {
+            if (!first)
+                result += ",";
+            result += item;
+            first = false;
+        }
+        return result;
+    }
+};
+
+template <> struct YamlTraits<std::pmr::map<std::pmr::string, std::pmr::string>>
+{
+    using type = std::pmr::map<std::pmr::string, std::pmr::string>;
+    static void parse(std::pmr::map<std::pmr::string, std::pmr::string>& obj, const YAML::Node& node)
+    {
+        if (!node.IsMap())
+            throw YAML::TypedBadConversion<std::map<std::string, std::string>>(node.Mark());
+        obj.clear();
+        for (const auto& entry : node)
+        {
+            if (!entry.first.IsScalar() || !entry.second.IsScalar())
+                throw YAML::TypedBadConversion<std::string>(entry.second.Mark());
+            obj.emplace(entry.first.Scalar(), entry.second.Scalar());
+        }
+    }
+    static std::string toString(const std::pmr::map<std::pmr::string, std::pmr::string>& obj)
+    {
+        std::string result;
+        bool first = true;
+        for (const auto& [k, v] : obj)
+        {
+            if (!first)
+                result += ",";
+            result.append(k).append("=").append(v);
+            first = false;
+        }
+        return result;
+    }
+};
+
 // ============================================================================
 // DISPATCH FUNCTIONS - Compiler picks the right overload!
 // ============================================================================
 
-template <HasYamlTraits T> void dispatchParse(T& obj, const YAML::Node& node)
+// Traits either throw on bad input or return a ValidationResult; callers
+// always get a ValidationResult back (exceptions still propagate)
+template <HasYamlTraits T> ValidationResult dispatchParse(T& obj, const YAML::Node& node)
 {
-    YamlTraits<T>::parse(obj, node);
+    if constexpr (std::is_same_v<decltype(YamlTraits<T>::parse(obj, node)), ValidationResult>)
+    {
+        return YamlTraits<T>::parse(obj, node);
+    }
+    else
+    {
+        YamlTraits<T>::parse(obj, node);
+        return ValidationResult();
+    }
 }
 
-template <IsEnum T> void dispatchParse(T& obj, const YAML::Node& node)
+template <IsEnum T> ValidationResult dispatchParse(T& obj, const YAML::Node& node)
 {
     if constexpr (requires { typename EnumMapping<T>::Type; })
     {
@@ -297,8 +498,14 @@ template <IsEnum T> void dispatchParse(T& obj, const YAML::Node& node)
         if (val)
             obj = val.value();
     }
+    return ValidationResult();
 }
 
+// Nested structs; defined with the parsing functions below
+template <NestedFields T> ValidationResult dispatchParse(T& obj, const YAML::Node& node);
+
+template <NestedFields T> std::string dispatchToString(const T& obj);
+
 template <HasYamlTraits T> std::string dispatchToString(const T& obj)
 {
     return YamlTraits<T>::toString(obj);
@@ -318,9 +525,15 @@ template <IsEnum T> std::string dispatchToString(const T& obj)
 // Field Definition
 // ============================================================================
 
-template <auto MemberPtr> struct Field
+// Constraint (optional) is any type with static validate(value) / error(value),
+// the same interface ConstrainedMap / ConstrainedVector use. It is checked by
+// fromYamlWithValidation after the member parses, e.g.
+//   meta::Field<&User::email, meta::PatternConstraint<"...">>("email", "...", meta::RequiredField)
+
+template <auto MemberPtr, typename Constraint = void> struct Field
 {
     using type = typename member_pointer_traits<decltype(MemberPtr)>::type;
+    using constraint = Constraint;
 
     std::string_view fieldName;
     std::string_view fieldDesc;
@@ -335,92 +548,576 @@ template <auto MemberPtr> struct Field
     }
 };
 
+template <typename T>
+inline constexpr size_t field_count_v = std::tuple_size_v<std::remove_cvref_t<decltype(T::fields)>>;
+
+template <auto A, auto B> inline constexpr bool same_member_v = false;
+
+template <auto A> inline constexpr bool same_member_v<A, A> = true;
+
+// Position of Member in T::fields, or field_count_v<T> if it is not listed
+template <typename T, auto Member> consteval size_t fieldIndex()
+{
+    size_t index = field_count_v<T>;
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        ((same_member_v<std::remove_cvref_t<decltype(std::get<I>(T::fields))>::memberPtr, Member>
+              ? (index = I, true)
+              : false) ||
+         ...);
+    }(std::make_index_sequence<field_count_v<T>>{});
+    return index;
+}
+
+// What a Field constraint sees: the wrapped value of BoundedString and
+// friends, the member itself otherwise
+template <typename M> constexpr const auto& constraintSubject(const M& member)
+{
+    if constexpr (requires { member.val; })
+        return member.val;
+    else
+        return member;
+}
+
 // ============================================================================
-// PARSING FUNCTIONS - No if constexpr chains!
+// FIELD PATHS
 // ============================================================================
+//
+// A field is addressed from a root type by the chain of its indexes through
+// the nested T::fields tuples: std::index_sequence<1, 0> is the first field
+// of the root's second field. FieldPath turns a chain into the member it
+// names and its dotted name ("database.host"); the name is assembled at
+// compile time, once per chain, so error reports never build it at runtime.
+// paths.h builds the table of every path of a type on top of this.
+//
 
-template <HasFields T> std::optional<T> fromYaml(const YAML::Node& yaml)
+namespace detail
 {
-    T obj{};
+template <typename T, size_t I> using field_at_t = std::remove_cvref_t<decltype(std::get<I>(T::fields))>;
 
-    std::apply(
-        [&](auto&&... fields)
+template <typename Path, size_t I> struct path_append;
+
+template <size_t... P, size_t I> struct path_append<std::index_sequence<P...>, I>
+{
+    using type = std::index_sequence<P..., I>;
+};
+
+template <typename Path, size_t I> using path_append_t = typename path_append<Path, I>::type;
+
+template <typename T, size_t... Path> struct PathWalk
+{
+    using type = T;
+    static constexpr size_t length = 0;
+
+    static constexpr void write(char*) {}
+
+    template <typename Obj> static constexpr auto& get(Obj& obj)
+    {
+        return obj;
+    }
+};
+
+template <typename T, size_t I, size_t... Rest> struct PathWalk<T, I, Rest...>
+{
+    using FieldT = field_at_t<T, I>;
+    using Next = PathWalk<typename FieldT::type, Rest...>;
+    using type = typename Next::type;
+
+    static constexpr std::string_view name = std::get<I>(T::fields).fieldName;
+    static constexpr size_t length = name.size() + (sizeof...(Rest) > 0 ? 1 + Next::length : 0);
+
+    static constexpr void write(char* out)
+    {
+        for (char c : name)
+            *out++ = c;
+        if constexpr (sizeof...(Rest) > 0)
         {
-            (...,
-             [&](auto& field)
-             {
-                 if (!yaml[field.fieldName])
-                 {
-                     return;
-                 }
+            *out++ = '.';
+            Next::write(out);
+        }
+    }
 
-                 const auto& fieldNode = yaml[field.fieldName];
-                 using MemberType = typename std::remove_cvref_t<decltype(field)>::type;
+    template <typename Obj> static constexpr auto& get(Obj& obj)
+    {
+        return Next::get(obj.*FieldT::memberPtr);
+    }
+};
+} // namespace detail
 
-                 try
-                 {
-                     dispatchParse(obj.*field.memberPtr, fieldNode);
-                 }
-                 catch (const std::exception& e)
-		 {
-                     // Silently skip
-                 }
-                 catch (...)
-                 {
-                     // Catch anything
-                 }
-             }(fields));
-        },
-        T::fields);
+template <typename Root, typename Path> struct FieldPath;
 
+template <typename Root, size_t... P> struct FieldPath<Root, std::index_sequence<P...>>
+{
+    using Walk = detail::PathWalk<Root, P...>;
+    using type = typename Walk::type;
+
+    static constexpr auto text = []
+    {
+        std::array<char, Walk::length + 1> buffer{};
+        Walk::write(buffer.data());
+        return buffer;
+    }();
+
+    static constexpr std::string_view value{text.data(), Walk::length};
+
+    template <typename Obj> static constexpr auto& get(Obj& obj)
+    {
+        return Walk::get(obj);
+    }
+};
+
+template <typename Root, typename Path> using field_path_t = typename FieldPath<Root, Path>::type;
+
+// ============================================================================
+// FIELD MASKS
+// ============================================================================
+//
+// Picks which of T's fields a parse touches:
+//
+//   constexpr auto startup = meta::FieldMask<Gateway>::of<&Gateway::listen, &Gateway::tls>();
+//   auto gateway = meta::fromYaml<Gateway>(yaml, startup);
+//
+// Fields outside the mask keep their T{} value; their keys are not looked
+// up, so they are not checked for presence either, and rules that read
+// them do not run. Masks select top-level fields; a selected nested struct
+// is parsed whole.
+//
+
+template <HasFields T> class FieldMask
+{
+public:
+    constexpr FieldMask() = default;
+
+    static constexpr FieldMask all()
+    {
+        FieldMask mask;
+        for (size_t index = 0; index < field_count_v<T>; index++)
+            mask.words_[index / 64] |= uint64_t{1} << (index % 64);
+        return mask;
+    }
+
+    template <auto... Members> static constexpr FieldMask of()
+    {
+        FieldMask mask;
+        ((mask = mask.template with<Members>()), ...);
+        return mask;
+    }
+
+    template <auto Member> constexpr FieldMask with() const
+    {
+        constexpr size_t index = fieldIndex<T, Member>();
+        static_assert(index < field_count_v<T>, "Member is not listed in T::fields");
+        FieldMask mask = *this;
+        mask.words_[index / 64] |= uint64_t{1} << (index % 64);
+        return mask;
+    }
+
+    constexpr bool contains(size_t index) const
+    {
+        return (words_[index / 64] >> (index % 64)) & 1;
+    }
+
+    constexpr size_t count() const
+    {
+        size_t total = 0;
+        for (uint64_t word : words_)
+            total += static_cast<size_t>(std::popcount(word));
+        return total;
+    }
+
+    constexpr FieldMask operator|(const FieldMask& other) const
+    {
+        FieldMask mask = *this;
+        for (size_t i = 0; i < words_.size(); i++)
+            mask.words_[i] |= other.words_[i];
+        return mask;
+    }
+
+    constexpr bool operator==(const FieldMask&) const = default;
+
+private:
+    std::array<uint64_t, (field_count_v<T> + 63) / 64> words_{};
+};
+
+// ============================================================================
+// MEMORY RESOURCES
+// ============================================================================
+//
+// Passing a std::pmr::memory_resource to fromYaml / fromYamlWithValidation
+// rebinds every allocator-aware member (std::pmr::string, pmr containers,
+// meta::pmr:: types) to that resource before parsing, so everything the
+// parse allocates comes from it:
+//
+//   std::pmr::monotonic_buffer_resource arena;
+//   auto req = meta::fromYaml<Request>(yaml, &arena);
+//   ...
+//   // drop req, then arena.release()
+//
+
+template <typename M> void bindResource(M& member, std::pmr::memory_resource* resource)
+{
+    if constexpr (std::uses_allocator_v<M, std::pmr::polymorphic_allocator<std::byte>>)
+    {
+        // pmr allocators do not propagate on assignment, so assigning the
+        // current value (in-class defaults included) to an object built with
+        // the new allocator copies it into the resource; moving that object
+        // into place keeps its allocator
+        M rebound = std::make_obj_using_allocator<M>(std::pmr::polymorphic_allocator<std::byte>(resource));
+        rebound = std::move(member);
+        std::destroy_at(&member);
+        std::construct_at(&member, std::move(rebound));
+    }
+    else if constexpr (HasFields<M>)
+    {
+        std::apply([&](auto&&... fields) { (..., bindResource(member.*fields.memberPtr, resource)); },
+                   M::fields);
+    }
+}
+
+template <HasFields T> T makeWithResource(std::pmr::memory_resource* resource)
+{
+    T obj{};
+    if (resource)
+    {
+        std::apply([&](auto&&... fields) { (..., bindResource(obj.*fields.memberPtr, resource)); },
+                   T::fields);
+    }
     return obj;
 }
 
+// ============================================================================
+// DEFAULT VALUES
+// ============================================================================
+//
+// A field missing from the YAML keeps whatever T{} gave it. Defaults of
+// SelfValidating members are checked once per type: at compile time when
+// T{} is a constant expression (defaults written with BoundedInt::of /
+// BoundedString::of), otherwise on first use. Parsing only reads the
+// cached answer.
+//
+
+template <HasFields T, auto MemberPtr> constexpr bool defaultMemberIsValid()
+{
+    using MemberType = typename member_pointer_traits<decltype(MemberPtr)>::type;
+    if constexpr (SelfValidating<MemberType>)
+    {
+        T obj{};
+        return (obj.*MemberPtr).isValid();
+    }
+    else
+    {
+        return true;
+    }
+}
+
+template <typename T, auto MemberPtr>
+concept ConstantDefault =
+    requires { typename std::bool_constant<defaultMemberIsValid<T, MemberPtr>()>; };
+
+template <HasFields T, auto MemberPtr> bool defaultIsValid()
+{
+    if constexpr (ConstantDefault<T, MemberPtr>)
+    {
+        return std::bool_constant<defaultMemberIsValid<T, MemberPtr>()>::value;
+    }
+    else
+    {
+        static const bool valid = defaultMemberIsValid<T, MemberPtr>();
+        return valid;
+    }
+}
 
+// ============================================================================
+// CROSS-FIELD RULES
+// ============================================================================
+//
+// Checks that involve more than one field sit next to T::fields:
+//
+//   static constexpr auto rules = std::tuple{
+//       meta::Rule<&Config::host, &Config::port>(
+//           [](const std::string& host, const int& port) { return host.empty() || port != 0; },
+//           "port is required when host is set")};
+//
+// The predicate takes the members in the order listed and must not
+// capture (it is stored as a plain function pointer). Each rule is wired at
+// compile time to the last of its inputs in T::fields order: it runs as
+// soon as that field has been parsed, only if all of its inputs parsed
+// cleanly, and reports under that field's name.
+//
 
-  template <HasFields T>
-std::pair<std::optional<T>, ValidationResult> fromYamlWithValidation(const YAML::Node& yaml)
+template <auto... Members> struct Rule
 {
-    T obj{};
-    ValidationResult result;
+    static_assert(sizeof...(Members) > 0, "Rule needs at least one member");
 
-    std::apply(
-        [&](auto&&... fields)
+    using Predicate = bool (*)(const typename member_pointer_traits<decltype(Members)>::type&...);
+
+    Predicate predicate;
+    std::string_view message;
+
+    constexpr Rule(Predicate pred, std::string_view msg) : predicate(pred), message(msg) {}
+
+    template <typename T> bool check(const T& obj) const
+    {
+        return predicate(obj.*Members...);
+    }
+};
+
+template <typename T>
+concept HasRules = HasFields<T> && requires { T::rules; };
+
+enum class ParseMode : uint8_t
+{
+    CollectAll,
+    FailFast
+};
+
+namespace detail
+{
+// Index of the field after which a rule runs: the last of its inputs
+template <HasFields T, typename Rule> struct RuleTrigger;
+
+template <HasFields T, auto... Members> struct RuleTrigger<T, Rule<Members...>>
+{
+    static consteval size_t compute()
+    {
+        constexpr size_t indexes[] = {fieldIndex<T, Members>()...};
+        size_t last = 0;
+        for (size_t index : indexes)
         {
-            (...,
-             [&](auto& field)
-             {
-                 if (!yaml[field.fieldName])
-                 {
-                     if (field.requirement == Requirement::Required)
-                     {
-                         result.addError(field.fieldName, "Missing required field");
-                     }
-                     return;
-                 }
+            if (index == field_count_v<T>)
+                throw "Rule input is not listed in T::fields";
+            last = index > last ? index : last;
+        }
+        return last;
+    }
 
-                 const auto& fieldNode = yaml[field.fieldName];
-                 using MemberType = typename std::remove_cvref_t<decltype(field)>::type;
+    static constexpr size_t value = compute();
+};
 
-                 try
-                 {
-                     dispatchParse(obj.*field.memberPtr, fieldNode);
-                 }
-                 catch (const std::exception& e)
-                 {
-                     result.addError(field.fieldName, std::string("Parse error: ") + e.what());
-                 }
-                 catch (...)
+template <HasFields T, size_t N, auto... Members>
+void runRule(const Rule<Members...>& rule, const T& obj, const std::array<bool, N>& parsed,
+             ValidationResult& result, std::string_view reportAs)
+{
+    if ((parsed[fieldIndex<T, Members>()] && ...) && !rule.check(obj))
+        result.addError(reportAs, std::string(rule.message));
+}
+} // namespace detail
+
+// Runs the rules whose last input is field I of the struct at Path
+template <HasFields Root, typename Path, size_t I, size_t N>
+void runRulesAfter(const field_path_t<Root, Path>& obj, const std::array<bool, N>& parsed,
+                   ValidationResult& result)
+{
+    using T = field_path_t<Root, Path>;
+    if constexpr (HasRules<T>)
+    {
+        std::apply(
+            [&](const auto&... rules)
+            {
+                (...,
+                 [&](const auto& rule)
                  {
-                     result.addError(field.fieldName, "Unknown parse error");
-                 }
-             }(fields));
-        },
-        T::fields);
+                     if constexpr (detail::RuleTrigger<T, std::remove_cvref_t<decltype(rule)>>::value == I)
+                         detail::runRule(rule, obj, parsed, result,
+                                         FieldPath<Root, detail::path_append_t<Path, I>>::value);
+                 }(rules));
+            },
+            T::rules);
+    }
+}
+
+namespace detail
+{
+template <HasFields Root, typename Path>
+void validateRulesAt(const field_path_t<Root, Path>& obj, ValidationResult& result)
+{
+    using T = field_path_t<Root, Path>;
+    std::array<bool, field_count_v<T>> all;
+    all.fill(true);
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        (...,
+         [&]
+         {
+             using Member = typename field_at_t<T, I>::type;
+             if constexpr (NestedFields<Member>)
+                 validateRulesAt<Root, path_append_t<Path, I>>(obj.*field_at_t<T, I>::memberPtr, result);
+             runRulesAfter<Root, Path, I>(obj, all, result);
+         }());
+    }(std::make_index_sequence<field_count_v<T>>{});
+}
+} // namespace detail
+
+// Checks T::rules (and those of nested structs) against an object that is
+// already built
+template <HasFields T> ValidationResult validateRules(const T& obj)
+{
+    ValidationResult result;
+    detail::validateRulesAt<T, std::index_sequence<>>(obj, result);
+    return result;
+}
+
+// ============================================================================
+// PARSING FUNCTIONS - No if constexpr chains!
+// ============================================================================
+
+template <HasFields T>
+std::optional<T> fromYaml(const YAML::Node& yaml, const FieldMask<T>& mask,
+                         std::pmr::memory_resource* resource = nullptr)
+{
+    T obj = makeWithResource<T>(resource);
+
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        (...,
+         [&](auto& field)
+         {
+             if (!mask.contains(I) || !yaml[field.fieldName])
+             {
+                 return;
+             }
+
+             const auto& fieldNode = yaml[field.fieldName];
+
+             try
+             {
+                 dispatchParse(obj.*field.memberPtr, fieldNode);
+             }
+             catch (const std::exception& e)
+             {
+                 // Silently skip
+             }
+             catch (...)
+             {
+                 // Catch anything
+             }
+         }(std::get<I>(T::fields)));
+    }(std::make_index_sequence<field_count_v<T>>{});
+
+    return obj;
+}
+
+template <HasFields T>
+std::optional<T> fromYaml(const YAML::Node& yaml, std::pmr::memory_resource* resource = nullptr)
+{
+    return fromYaml<T>(yaml, FieldMask<T>::all(), resource);
+}
+
+namespace detail
+{
+template <HasFields Root, ParseMode Mode, typename Path>
+void parseFields(field_path_t<Root, Path>& obj, const YAML::Node& yaml, ValidationResult& result,
+                 const FieldMask<field_path_t<Root, Path>>& mask);
+
+// Parses field I of the struct at Path; returns true if it parsed (or
+// defaulted) cleanly. Errors are reported under the field's full path.
+template <HasFields Root, ParseMode Mode, typename Path, size_t I>
+bool parseField(field_path_t<Root, Path>& obj, const YAML::Node& yaml, ValidationResult& result)
+{
+    using T = field_path_t<Root, Path>;
+    using FieldT = field_at_t<T, I>;
+    using Member = typename FieldT::type;
+    constexpr std::string_view path = FieldPath<Root, path_append_t<Path, I>>::value;
+    const auto& field = std::get<I>(T::fields);
+
+    if (!yaml[field.fieldName])
+    {
+        if (field.requirement == Requirement::Required)
+        {
+            result.addError(path, "Missing required field");
+            return false;
+        }
+        if (!defaultIsValid<T, FieldT::memberPtr>())
+        {
+            result.addError(path, "Missing field and default value is invalid");
+            return false;
+        }
+        return true;
+    }
+
+    const auto& fieldNode = yaml[field.fieldName];
+    Member& member = obj.*field.memberPtr;
+
+    try
+    {
+        ValidationResult fieldResult;
+        if constexpr (NestedFields<Member>)
+        {
+            if (!fieldNode.IsMap())
+            {
+                result.addError(path, "Expected a mapping");
+                return false;
+            }
+            size_t errorsBefore = result.errors.size();
+            parseFields<Root, Mode, path_append_t<Path, I>>(member, fieldNode, result,
+                                                            FieldMask<Member>::all());
+            if (result.errors.size() != errorsBefore)
+                return false;
+        }
+        else
+        {
+            fieldResult = dispatchParse(member, fieldNode);
+        }
+
+        using Constraint = typename FieldT::constraint;
+        if constexpr (!std::is_void_v<Constraint>)
+        {
+            const auto& subject = constraintSubject(member);
+            if (fieldResult.valid && !Constraint::validate(subject))
+            {
+                fieldResult.addError("", Constraint::error(subject));
+            }
+        }
+
+        result.mergeErrors(path, fieldResult);
+        return fieldResult.valid;
+    }
+    catch (const std::exception& e)
+    {
+        result.addError(path, std::string("Parse error: ") + e.what());
+    }
+    catch (...)
+    {
+        result.addError(path, "Unknown parse error");
+    }
+    return false;
+}
+
+template <HasFields Root, ParseMode Mode, typename Path>
+void parseFields(field_path_t<Root, Path>& obj, const YAML::Node& yaml, ValidationResult& result,
+                 const FieldMask<field_path_t<Root, Path>>& mask)
+{
+    using T = field_path_t<Root, Path>;
+    std::array<bool, field_count_v<T>> parsed{};
+
+    // && short-circuits, so FailFast never touches the fields after an error
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        (... && [&]
+         {
+             if (!mask.contains(I))
+                 return true;
+             parsed[I] = parseField<Root, Mode, Path, I>(obj, yaml, result);
+             runRulesAfter<Root, Path, I>(obj, parsed, result);
+             return Mode == ParseMode::CollectAll || result.valid;
+         }());
+    }(std::make_index_sequence<field_count_v<T>>{});
+}
+} // namespace detail
+
+// CollectAll reports every problem; FailFast stops at the first field or
+// rule that fails and skips the rest of the document
+template <HasFields T, ParseMode Mode = ParseMode::CollectAll>
+std::pair<std::optional<T>, ValidationResult> fromYamlWithValidation(const YAML::Node& yaml, const FieldMask<T>& mask,
+                                                                     std::pmr::memory_resource* resource = nullptr)
+{
+    T obj = makeWithResource<T>(resource);
+    ValidationResult result;
+    detail::parseFields<T, Mode, std::index_sequence<>>(obj, yaml, result, mask);
 
     if (result.valid)
     {
-        return {obj, result};
+        return {std::move(obj), result};
     }
     else
     {
@@ -428,6 +1125,44 @@ std::pair<std::optional<T>, ValidationResult> fromYamlWithValidation(const YAML:
     }
 }
 
+template <HasFields T, ParseMode Mode = ParseMode::CollectAll>
+std::pair<std::optional<T>, ValidationResult> fromYamlWithValidation(const YAML::Node& yaml,
+                                                                     std::pmr::memory_resource* resource = nullptr)
+{
+    return fromYamlWithValidation<T, Mode>(yaml, FieldMask<T>::all(), resource);
+}
+
+template <NestedFields T> ValidationResult dispatchParse(T& obj, const YAML::Node& node)
+{
+    ValidationResult result;
+    if (!node.IsMap())
+        result.addError("", "Expected a mapping");
+    else
+        detail::parseFields<T, ParseMode::CollectAll, std::index_sequence<>>(obj, node, result,
+                                                                          FieldMask<T>::all());
+    return result;
+}
+
+// Nested structs print as a flow mapping: {host: db1, port: 5432}
+template <NestedFields T> std::string dispatchToString(const T& obj)
+{
+    std::string out = "{";
+    std::apply(
+        [&](auto&&... fields)
+        {
+            (...,
+             [&](auto& field)
+             {
+                 if (out.size() > 1)
+                     out += ", ";
+                 out += field.fieldName;
+                 out += ": ";
+                 out += dispatchToString(obj.*field.memberPtr);
+             }(fields));
+        },
+        T::fields);
+    return out + "}";
+}
 
 template <HasFields T> std::string toString(const T& obj)
 {
@@ -519,6 +1254,178 @@ template <HasFields T> std::string toJson(const T& obj)
     return oss.str();
 }
 
+// ============================================================================
+// JSON LINES - one compact record per line
+// ============================================================================
+
+// appendJson writes obj on a single line, appending to out so a batch of
+// records can share one buffer. Unlike toJson, strings are escaped, nested
+// structs and maps become objects, sequences become arrays, and wrappers
+// whose value() is a number (BoundedInt) stay numbers. Floating-point values
+// are written in their shortest round-trip form; NaN and infinities as null.
+
+namespace detail
+{
+
+inline void appendJsonString(std::string& out, std::string_view text)
+{
+    static constexpr char hex[] = "0123456789abcdef";
+    out += '"';
+    for (char c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                out += "\\u00";
+                out += hex[(c >> 4) & 0xf];
+                out += hex[c & 0xf];
+            }
+            else
+            {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+template <typename M>
+concept JsonNumber = std::is_arithmetic_v<M> || requires(const M& value) {
+    requires std::is_arithmetic_v<std::remove_cvref_t<decltype(value.value())>>;
+};
+
+// Maps (std::map, ConstrainedMap, ContainersMap, ...) become objects
+template <typename M>
+concept JsonObject = std::ranges::input_range<const M> && requires { typename M::mapped_type; };
+
+// Lists (std::vector, InlineVector, BoundedVector, ...); strings are not arrays
+template <typename M>
+concept JsonArray = std::ranges::input_range<const M> && !std::is_convertible_v<const M&, std::string_view> &&
+                    !JsonObject<M>;
+
+// Object keys are always strings in JSON
+template <typename K> void appendJsonKey(std::string& out, const K& key)
+{
+    if constexpr (std::is_convertible_v<const K&, std::string_view>)
+        appendJsonString(out, key);
+    else if constexpr (std::is_integral_v<K>)
+        appendJsonString(out, std::to_string(key));
+    else
+        appendJsonString(out, dispatchToString(key));
+}
+
+template <std::floating_point F> void appendJsonFloat(std::string& out, F value)
+{
+    if (!std::isfinite(value))
+    {
+        out += "null";
+        return;
+    }
+    char buffer[64];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, end);
+}
+
+template <NestedFields T> void appendJsonObject(std::string& out, const T& obj);
+
+template <typename M> void appendJsonValue(std::string& out, const M& value)
+{
+    if constexpr (NestedFields<M>)
+        appendJsonObject(out, value);
+    else if constexpr (std::is_floating_point_v<M>)
+        appendJsonFloat(out, value);
+    else if constexpr (JsonNumber<M>)
+        out += dispatchToString(value);
+    else if constexpr (JsonObject<M>)
+    {
+        out += '{';
+        bool first = true;
+        for (auto&& [key, element] : value)
+        {
+            if (!first)
+                out += ',';
+            first = false;
+            appendJsonKey(out, key);
+            out += ':';
+            appendJsonValue(out, element);
+        }
+        out += '}';
+    }
+    else if constexpr (JsonArray<M>)
+    {
+        out += '[';
+        bool first = true;
+        for (const auto& element : value)
+        {
+            if (!first)
+                out += ',';
+            first = false;
+            appendJsonValue(out, element);
+        }
+        out += ']';
+    }
+    else
+        appendJsonString(out, dispatchToString(value));
+}
+
+template <NestedFields T> void appendJsonObject(std::string& out, const T& obj)
+{
+    out += '{';
+    bool first = true;
+    std::apply(
+        [&](auto&&... fields)
+        {
+            (...,
+             [&](auto& field)
+             {
+                 if (!first)
+                     out += ',';
+                 first = false;
+                 appendJsonString(out, field.fieldName);
+                 out += ':';
+                 appendJsonValue(out, obj.*field.memberPtr);
+             }(fields));
+        },
+        T::fields);
+    out += '}';
+}
+
+} // namespace detail
+
+template <HasFields T> void appendJson(std::string& out, const T& obj)
+{
+    if constexpr (NestedFields<T>)
+        detail::appendJsonObject(out, obj);
+    else
+        detail::appendJsonString(out, dispatchToString(obj));
+}
+
+// {"name":"a","port":80}\n
+template <HasFields T> std::string toJsonLine(const T& obj)
+{
+    std::string out;
+    appendJson(out, obj);
+    out += '\n';
+    return out;
+}
+
 
 
   
@@ -0,0 +1,90 @@
+#include "meta.h"
+#include "bounded.h"
+#include "network.h"
+#include <iostream>
+
+// ============================================================================
+// STRUCT WITH NETWORK FIELDS
+// ============================================================================
+
+struct DatabaseConfig {
+  meta::BoundedString<1, 255> host;
+  int port = 5432;
+  meta::IpAddress bind;
+  std::string admin_url;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&DatabaseConfig::host, meta::HostConstraint>("host", "Database host", meta::RequiredField),
+        meta::Field<&DatabaseConfig::port, meta::PortConstraint>("port", "Database port", meta::OptionalField),
+        meta::Field<&DatabaseConfig::bind>("bind", "Local address to bind", meta::OptionalField),
+        meta::Field<&DatabaseConfig::admin_url, meta::UrlConstraint>("admin_url", "Admin console", meta::OptionalField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Network Constraints ===\n\n";
+
+    // ========================================
+    // Valid endpoints
+    // ========================================
+    std::cout << "--- Valid Config ---\n";
+
+    YAML::Node good = YAML::Load(R"(
+        host: db1.internal.example.com
+        port: 6432
+        bind: "fd00::10"
+        admin_url: https://db1.internal.example.com:8443/console
+    )");
+
+    auto [config, result] = meta::fromYamlWithValidation<DatabaseConfig>(good);
+    if (config) {
+        std::cout << "✓ Parsed:\n" << meta::toString(*config);
+        std::cout << "  bind is " << (config->bind.isV6() ? "IPv6" : "IPv4")
+                  << ", " << config->bind.length() << " bytes ready for connect()\n";
+    }
+
+    // ========================================
+    // Invalid endpoints
+    // ========================================
+    std::cout << "\n--- Invalid Config ---\n";
+
+    YAML::Node bad = YAML::Load(R"(
+        host: db1..internal
+        port: 70000
+        bind: 10.0.0.256
+        admin_url: https://db1:8443 /console
+    )");
+
+    auto [config2, result2] = meta::fromYamlWithValidation<DatabaseConfig>(bad);
+    if (!config2) {
+        for (const auto& [field, error] : result2.errors) {
+            std::cout << "  ✗ " << field << ": " << error << "\n";
+        }
+    }
+
+    // ========================================
+    // Direct use
+    // ========================================
+    std::cout << "\n--- Direct Checks ---\n";
+
+    for (std::string_view addr : {"192.168.1.10", "::1", "2001:db8::8a2e:370:7334", "1.2.3", "::ffff:10.0.0.1"}) {
+        std::cout << (meta::IpAddressConstraint::validate(addr) ? "  ✓ " : "  ✗ ") << addr << "\n";
+    }
+
+    // A dotted quad that fails as an address is not a hostname either
+    for (std::string_view host : {"db1.internal", "10.0.0.1", "256.1.1.1", "3com.example"}) {
+        std::cout << (meta::HostConstraint::validate(host) ? "  ✓ " : "  ✗ ") << "host " << host << "\n";
+    }
+
+    using Slug = meta::CharsetConstraint<"-0-9_a-z">;
+    for (std::string_view slug : {"primary-db_01", "Primary DB"}) {
+        std::cout << (Slug::validate(slug) ? "  ✓ " : "  ✗ ") << "slug '" << slug << "'\n";
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,415 @@
+#pragma once
+#include "meta.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace meta {
+
+// ============================================================================
+// NETWORK CONSTRAINTS
+// ============================================================================
+//
+// Ready-made constraints for endpoint fields. They use the same static
+// validate / error interface as the other constraints, so they work on
+// Field (any string-like member, including BoundedString) and as key /
+// value constraints of ConstrainedMap / ConstrainedVector:
+//
+//   meta::Field<&DatabaseConfig::host, meta::HostnameConstraint>("host", ...)
+//   meta::Field<&DatabaseConfig::port, meta::PortConstraint>("port", ...)
+//
+//   CharsetConstraint<"a-z0-9._-">  every byte in the listed ranges
+//   HostnameConstraint              RFC 1123 hostname
+//   IpAddressConstraint             IPv4 dotted quad or IPv6 text form
+//   HostConstraint                  hostname or IP address
+//   PortConstraint                  integer in [1, 65535]
+//   UrlConstraint                   scheme://host[:port][/path][?query][#fragment]
+//
+// Character classes are checked 16 bytes at a time with SSE2 where
+// available; addresses are parsed in a single left-to-right pass.
+//
+
+namespace detail::net {
+
+// Up to 8 inclusive byte ranges parsed from a spec like "a-z0-9._-"
+// (a '-' at either end is literal)
+struct ByteRanges {
+    std::array<unsigned char, 8> lo{};
+    std::array<unsigned char, 8> hi{};
+    size_t count = 0;
+    std::array<uint64_t, 4> table{};
+
+    constexpr explicit ByteRanges(std::string_view spec) {
+        for (size_t i = 0; i < spec.size(); i++) {
+            unsigned char a = static_cast<unsigned char>(spec[i]);
+            unsigned char b = a;
+            if (i + 2 < spec.size() && spec[i + 1] == '-') {
+                b = static_cast<unsigned char>(spec[i + 2]);
+                if (b < a) throw "CharsetConstraint: reversed range";
+                i += 2;
+            }
+            add(a, b);
+        }
+    }
+
+    constexpr void add(unsigned char a, unsigned char b) {
+        // Adjacent single bytes merge into the previous range where possible
+        if (count > 0 && a == hi[count - 1] + 1) {
+            hi[count - 1] = b;
+        } else {
+            if (count == lo.size()) throw "CharsetConstraint: at most 8 ranges";
+            lo[count] = a;
+            hi[count] = b;
+            count++;
+        }
+        for (unsigned c = a; c <= b; c++) table[c / 64] |= uint64_t{1} << (c % 64);
+    }
+
+    constexpr bool test(unsigned char c) const { return (table[c / 64] >> (c % 64)) & 1; }
+};
+
+template<FixedString Spec>
+inline constexpr ByteRanges rangesOf{Spec.view()};
+
+// True if every byte of s is in one of the ranges
+template<const ByteRanges& R>
+inline bool allInRanges(std::string_view s) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= s.size(); i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+        __m128i ok = _mm_setzero_si128();
+        for (size_t r = 0; r < R.count; r++) {
+            // c in [lo, hi]  <=>  (c - lo) <= (hi - lo), unsigned
+            __m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>(R.lo[r])));
+            __m128i width = _mm_set1_epi8(static_cast<char>(R.hi[r] - R.lo[r]));
+            ok = _mm_or_si128(ok, _mm_cmpeq_epi8(_mm_min_epu8(shifted, width), shifted));
+        }
+        if (_mm_movemask_epi8(ok) != 0xFFFF) return false;
+    }
+#endif
+    for (; i < s.size(); i++) {
+        if (!R.test(static_cast<unsigned char>(s[i]))) return false;
+    }
+    return true;
+}
+
+constexpr bool isDigit(char c) { return c >= '0' && c <= '9'; }
+constexpr bool isAlnum(char c) { return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+constexpr int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+}  // namespace detail::net
+
+// ----------------------------------------------------------------------------
+// Address parsing (single pass, no allocation)
+// ----------------------------------------------------------------------------
+
+// Dotted quad, no leading zeros ("010" is rejected as ambiguous)
+constexpr bool parseIpv4(std::string_view s, std::array<uint8_t, 4>& out) {
+    size_t i = 0;
+    for (size_t part = 0; part < 4; part++) {
+        if (part > 0) {
+            if (i >= s.size() || s[i] != '.') return false;
+            i++;
+        }
+        size_t start = i;
+        unsigned value = 0;
+        while (i < s.size() && detail::net::isDigit(s[i]) && i - start < 3) {
+            value = value * 10 + static_cast<unsigned>(s[i] - '0');
+            i++;
+        }
+        size_t digits = i - start;
+        if (digits == 0 || value > 255 || (digits > 1 && s[start] == '0')) return false;
+        out[part] = static_cast<uint8_t>(value);
+    }
+    return i == s.size();
+}
+
+// RFC 4291 text form: eight groups, one "::" run, optional dotted-quad tail
+constexpr bool parseIpv6(std::string_view s, std::array<uint8_t, 16>& out) {
+    std::array<uint16_t, 8> groups{};
+    size_t count = 0;
+    int gap = -1;  // group index where "::" sits
+    size_t i = 0;
+
+    if (s.size() >= 2 && s[0] == ':' && s[1] == ':') {
+        gap = 0;
+        i = 2;
+    } else if (!s.empty() && s[0] == ':') {
+        return false;
+    }
+
+    while (i < s.size()) {
+        if (count == 8) return false;
+
+        // Embedded IPv4 in the last 32 bits
+        size_t end = s.find(':', i);
+        std::string_view rest = s.substr(i, end == std::string_view::npos ? s.size() - i : end - i);
+        if (end == std::string_view::npos && rest.find('.') != std::string_view::npos) {
+            std::array<uint8_t, 4> v4{};
+            if (count > 6 || !parseIpv4(rest, v4)) return false;
+            groups[count++] = static_cast<uint16_t>(v4[0] << 8 | v4[1]);
+            groups[count++] = static_cast<uint16_t>(v4[2] << 8 | v4[3]);
+            i = s.size();
+            break;
+        }
+
+        unsigned value = 0;
+        size_t digits = 0;
+        while (i < s.size() && digits < 4) {
+            int h = detail::net::hexValue(s[i]);
+            if (h < 0) break;
+            value = value << 4 | static_cast<unsigned>(h);
+            digits++;
+            i++;
+        }
+        if (digits == 0) return false;
+        groups[count++] = static_cast<uint16_t>(value);
+
+        if (i == s.size()) break;
+        if (s[i] != ':') return false;
+        i++;
+        if (i < s.size() && s[i] == ':') {
+            if (gap >= 0) return false;
+            gap = static_cast<int>(count);
+            i++;
+        } else if (i == s.size()) {
+            return false;  // trailing single ':'
+        }
+    }
+
+    if (gap < 0 ? count != 8 : count == 8) return false;
+
+    std::array<uint16_t, 8> full{};
+    if (gap < 0) {
+        full = groups;
+    } else {
+        size_t tail = count - static_cast<size_t>(gap);
+        for (size_t g = 0; g < static_cast<size_t>(gap); g++) full[g] = groups[g];
+        for (size_t g = 0; g < tail; g++) full[8 - tail + g] = groups[static_cast<size_t>(gap) + g];
+    }
+    for (size_t g = 0; g < 8; g++) {
+        out[2 * g] = static_cast<uint8_t>(full[g] >> 8);
+        out[2 * g + 1] = static_cast<uint8_t>(full[g] & 0xFF);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Constraints
+// ----------------------------------------------------------------------------
+
+template<FixedString Spec>
+struct CharsetConstraint {
+    static bool validate(std::string_view value) {
+        return detail::net::allInRanges<detail::net::rangesOf<Spec>>(value);
+    }
+
+    static std::string error(std::string_view value) {
+        return "'" + std::string(value) + "' contains characters outside [" + std::string(Spec.view()) + "]";
+    }
+};
+
+struct HostnameConstraint {
+    static bool validate(std::string_view value) {
+        if (value.empty() || value.size() > 253) return false;
+        if (!CharsetConstraint<"-.0-9A-Za-z">::validate(value)) return false;
+
+        // Labels: 1-63 chars, no leading or trailing '-'. The last label may
+        // not be all digits (RFC 3696 section 2), so a malformed dotted quad
+        // such as 256.1.1.1 does not pass as a hostname
+        size_t start = 0;
+        while (true) {
+            size_t dot = value.find('.', start);
+            size_t end = dot == std::string_view::npos ? value.size() : dot;
+            size_t length = end - start;
+            if (length == 0 || length > 63) return false;
+            if (value[start] == '-' || value[end - 1] == '-') return false;
+            if (dot == std::string_view::npos) {
+                return value.substr(start).find_first_not_of("0123456789") != std::string_view::npos;
+            }
+            start = dot + 1;
+        }
+    }
+
+    static std::string error(std::string_view value) {
+        return "'" + std::string(value) + "' is not a valid hostname";
+    }
+};
+
+struct IpAddressConstraint {
+    static bool validate(std::string_view value) {
+        if (value.find(':') != std::string_view::npos) {
+            std::array<uint8_t, 16> bytes{};
+            return parseIpv6(value, bytes);
+        }
+        std::array<uint8_t, 4> bytes{};
+        return parseIpv4(value, bytes);
+    }
+
+    static std::string error(std::string_view value) {
+        return "'" + std::string(value) + "' is not a valid IP address";
+    }
+};
+
+// Anything a client could connect to: hostname or literal address
+struct HostConstraint {
+    static bool validate(std::string_view value) {
+        return IpAddressConstraint::validate(value) || HostnameConstraint::validate(value);
+    }
+
+    static std::string error(std::string_view value) {
+        return "'" + std::string(value) + "' is neither a hostname nor an IP address";
+    }
+};
+
+struct PortConstraint {
+    static constexpr bool validate(int value) { return value >= 1 && value <= 65535; }
+
+    static std::string error(int value) {
+        return "Port " + std::to_string(value) + " out of range [1, 65535]";
+    }
+};
+
+struct UrlConstraint {
+    static bool validate(std::string_view value) {
+        // scheme
+        size_t colon = value.find("://");
+        if (colon == std::string_view::npos || colon == 0 || !isSchemeStart(value[0])) return false;
+        for (size_t i = 1; i < colon; i++) {
+            char c = value[i];
+            if (!detail::net::isAlnum(c) && c != '+' && c != '-' && c != '.') return false;
+        }
+
+        // authority: host[:port], host may be [IPv6]
+        size_t start = colon + 3;
+        size_t end = value.find_first_of("/?#", start);
+        if (end == std::string_view::npos) end = value.size();
+        std::string_view authority = value.substr(start, end - start);
+        if (authority.find('@') != std::string_view::npos) return false;  // no userinfo
+
+        std::string_view host = authority;
+        std::string_view port;
+        if (!authority.empty() && authority[0] == '[') {
+            size_t close = authority.find(']');
+            if (close == std::string_view::npos) return false;
+            std::array<uint8_t, 16> bytes{};
+            if (!parseIpv6(authority.substr(1, close - 1), bytes)) return false;
+            std::string_view after = authority.substr(close + 1);
+            if (!after.empty()) {
+                if (after[0] != ':') return false;
+                port = after.substr(1);
+                if (port.empty()) return false;
+            }
+        } else {
+            size_t portColon = authority.rfind(':');
+            if (portColon != std::string_view::npos) {
+                host = authority.substr(0, portColon);
+                port = authority.substr(portColon + 1);
+                if (port.empty()) return false;
+            }
+            if (!HostConstraint::validate(host)) return false;
+        }
+        if (!port.empty() && !validPort(port)) return false;
+
+        // path / query / fragment: visible ASCII only
+        return CharsetConstraint<"!-~">::validate(value.substr(end));
+    }
+
+    static std::string error(std::string_view value) {
+        return "'" + std::string(value) + "' is not a valid URL";
+    }
+
+private:
+    static constexpr bool isSchemeStart(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+    static constexpr bool validPort(std::string_view port) {
+        if (port.size() > 5) return false;
+        int value = 0;
+        for (char c : port) {
+            if (!detail::net::isDigit(c)) return false;
+            value = value * 10 + (c - '0');
+        }
+        return PortConstraint::validate(value);
+    }
+};
+
+// ============================================================================
+// IP ADDRESS - text plus the parsed bytes
+// ============================================================================
+//
+// Parsed once while loading the config and kept next to the original
+// text, so nothing re-parses it at connect time. IPv4 addresses fill
+// bytes[0..3].
+//
+
+struct IpAddress {
+    enum class Family : uint8_t { None, V4, V6 };
+
+    std::string text;
+    Family family = Family::None;
+    std::array<uint8_t, 16> bytes{};
+
+    IpAddress() = default;
+
+    // Unchecked, like the other user types; isValid() reports the result
+    IpAddress(std::string_view value) { assign(value); }
+
+    bool assign(std::string_view value) {
+        text.assign(value);
+        bytes = {};
+        family = Family::None;
+        if (value.find(':') != std::string_view::npos) {
+            if (parseIpv6(value, bytes)) family = Family::V6;
+        } else {
+            std::array<uint8_t, 4> v4{};
+            if (parseIpv4(value, v4)) {
+                family = Family::V4;
+                for (size_t i = 0; i < 4; i++) bytes[i] = v4[i];
+            }
+        }
+        return isValid();
+    }
+
+    bool isValid() const { return family != Family::None; }
+    bool isV4() const { return family == Family::V4; }
+    bool isV6() const { return family == Family::V6; }
+
+    // Number of meaningful bytes in `bytes`
+    size_t length() const { return isV4() ? 4 : isV6() ? 16 : 0; }
+};
+
+template<>
+struct YamlTraits<IpAddress> {
+    using type = IpAddress;
+
+    static ValidationResult parse(IpAddress& obj, const YAML::Node& node) {
+        ValidationResult result;
+        if (!node.IsScalar()) {
+            result.addError("", "Expected an IP address");
+            return result;
+        }
+        if (!obj.assign(node.Scalar())) {
+            result.addError("", IpAddressConstraint::error(node.Scalar()));
+        }
+        return result;
+    }
+
+    static std::string toString(const IpAddress& obj) {
+        return obj.text;
+    }
+};
+
+}  // namespace meta
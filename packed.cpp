@@ -0,0 +1,116 @@
+#include "meta.h"
+#include "bounded.h"
+#include "packed.h"
+#include <iostream>
+#include <vector>
+
+// ============================================================================
+// ENUM + STRUCT
+// ============================================================================
+
+enum class SensorStatus { Ok, Degraded, Offline };
+
+template <>
+struct meta::EnumMapping<SensorStatus> {
+    static constexpr std::array mapping = std::array{
+        std::pair(SensorStatus::Ok, "ok"),
+        std::pair(SensorStatus::Degraded, "degraded"),
+        std::pair(SensorStatus::Offline, "offline"),
+    };
+    using Type = meta::EnumTraitsAuto<SensorStatus, mapping>;
+};
+
+struct Sensor {
+    meta::BoundedInt<0, 1000000> id;             // 20 bits
+    meta::BoundedInt<-40, 85> celsius;           // 7 bits
+    meta::BoundedInt<0, 100> humidity;           // 7 bits
+    SensorStatus status = SensorStatus::Ok;      // 2 bits
+    bool active = true;                          // 1 bit
+    meta::BoundedInt<0, 1000000> uptime_hours;   // 20 bits
+    meta::BoundedInt<1, 65535> port;             // 16 bits, crosses into word 2
+    std::string label;                           // not packed
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Sensor::id>("id", "Sensor id", meta::RequiredField),
+        meta::Field<&Sensor::celsius>("celsius", "Temperature", meta::RequiredField),
+        meta::Field<&Sensor::humidity>("humidity", "Relative humidity %", meta::RequiredField),
+        meta::Field<&Sensor::status>("status", "Sensor status", meta::RequiredField),
+        meta::Field<&Sensor::active>("active", "Reporting", meta::RequiredField),
+        meta::Field<&Sensor::uptime_hours>("uptime_hours", "Hours since boot", meta::RequiredField),
+        meta::Field<&Sensor::port>("port", "Collector port", meta::RequiredField),
+        meta::Field<&Sensor::label>("label", "Free-form label", meta::OptionalField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Bit-Packed Records ===\n\n";
+
+    using PackedSensor = meta::PackedRecord<Sensor>;
+
+    // ========================================
+    // Layout
+    // ========================================
+    std::cout << "--- Layout ---\n";
+    std::cout << "  sizeof(Sensor)       = " << sizeof(Sensor) << " bytes\n";
+    std::cout << "  packed fields        = " << PackedSensor::bits() << " bits in "
+              << PackedSensor::words() << " words\n";
+    std::cout << "  sizeof(PackedSensor) = " << sizeof(PackedSensor) << " bytes\n";
+
+    // ========================================
+    // Parse, pack, read back
+    // ========================================
+    std::cout << "\n--- Pack + get<>() ---\n";
+
+    YAML::Node yaml = YAML::Load(R"(
+        id: 734512
+        celsius: -12
+        humidity: 48
+        status: degraded
+        active: true
+        uptime_hours: 8760
+        port: 9100
+    )");
+
+    auto [sensor, result] = meta::fromYamlWithValidation<Sensor>(yaml);
+    if (!sensor) {
+        std::cout << "✗ Parse failed\n";
+        return 1;
+    }
+
+    PackedSensor packed(*sensor);
+    std::cout << "✓ celsius = " << packed.get<&Sensor::celsius>().value()
+              << ", status = " << meta::EnumMapping<SensorStatus>::Type::toString(packed.get<&Sensor::status>())
+              << ", port = " << packed.get<&Sensor::port>().value() << "\n";
+
+    // ========================================
+    // set<>() and unpack()
+    // ========================================
+    std::cout << "\n--- set<>() + unpack() ---\n";
+
+    packed.set<&Sensor::active>(false);
+    packed.set<&Sensor::status>(SensorStatus::Offline);
+    std::cout << "✓ Unpacked:\n" << meta::toString(packed.unpack());
+
+    try {
+        packed.set<&Sensor::humidity>(meta::BoundedInt<0, 100>(101));
+        std::cout << "✓ Set\n";
+    } catch (const std::exception& e) {
+        std::cout << "✗ " << e.what() << "\n";
+    }
+
+    // ========================================
+    // Many records
+    // ========================================
+    std::cout << "\n--- 1M Records ---\n";
+
+    std::vector<PackedSensor> cache(1000000, packed);
+    std::cout << "  " << cache.size() * sizeof(PackedSensor) / 1024 << " KiB packed vs "
+              << cache.size() * sizeof(Sensor) / 1024 << " KiB unpacked\n";
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,232 @@
+#pragma once
+#include "meta.h"
+#include "bounded.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace meta {
+
+// ============================================================================
+// PACKED RECORD - bit-packed copy of a struct's small fields
+// ============================================================================
+//
+// PackedRecord<T> lays out every packable field in T::fields back to back in
+// as few 64-bit words as possible:
+//
+//   BoundedInt<Min, Max>   bit_width(Max - Min) bits, stored as value - Min
+//   enum with a mapping    bit_width(mapping.size() - 1) bits, stored as the
+//                          index into EnumMapping<E>::Type::mapping
+//   bool                   1 bit
+//
+// Fields may straddle a word boundary. Other members (strings, containers)
+// are not packed; get/set reject them at compile time and unpack() leaves
+// them default-constructed.
+//
+// Usage:
+//   meta::PackedRecord<Sensor> packed(sensor);
+//   int t = packed.get<&Sensor::celsius>().value();
+//   packed.set<&Sensor::active>(false);
+//
+// A zeroed record decodes to Min / the first mapped enumerator / false.
+//
+
+namespace detail {
+
+template<typename M>
+struct PackedCodec;  // width, encode, decode per packable member type
+
+template<>
+struct PackedCodec<bool> {
+    static constexpr unsigned width = 1;
+    static constexpr uint64_t encode(bool v) { return v ? 1 : 0; }
+    static constexpr bool decode(uint64_t bits) { return bits != 0; }
+};
+
+template<int Min, int Max, IntEncoding Encoding>
+struct PackedCodec<BoundedInt<Min, Max, Encoding>> {
+    using type = BoundedInt<Min, Max, Encoding>;
+
+    static constexpr unsigned width =
+        static_cast<unsigned>(std::bit_width(static_cast<uint64_t>(int64_t{Max} - Min)));
+
+    static uint64_t encode(const type& v) {
+        if (!v.isValid()) {
+            throw std::out_of_range(
+                "Value " + std::to_string(v.value()) + " cannot be packed into [" +
+                std::to_string(Min) + ", " + std::to_string(Max) + "]"
+            );
+        }
+        return static_cast<uint64_t>(int64_t{v.value()} - Min);
+    }
+
+    static type decode(uint64_t bits) {
+        return type(static_cast<int>(static_cast<int64_t>(bits) + Min));
+    }
+};
+
+template<typename E>
+concept HasEnumMappingArray = RegisteredEnum<E> && requires {
+    EnumMapping<E>::Type::mapping.size();
+};
+
+template<typename E>
+    requires HasEnumMappingArray<E>
+struct PackedCodec<E> {
+    static constexpr auto& mapping = EnumMapping<E>::Type::mapping;
+    static_assert(mapping.size() > 0, "EnumMapping needs at least one entry");
+
+    static constexpr unsigned width =
+        static_cast<unsigned>(std::bit_width(static_cast<uint64_t>(mapping.size() - 1)));
+
+    static uint64_t encode(E v) {
+        for (size_t i = 0; i < mapping.size(); i++) {
+            if (mapping[i].first == v) return i;
+        }
+        throw std::out_of_range("Enum value has no EnumMapping entry and cannot be packed");
+    }
+
+    static E decode(uint64_t bits) { return mapping[bits].first; }
+};
+
+template<typename M>
+concept Packable = requires { PackedCodec<M>::width; };
+
+constexpr uint64_t lowBits(unsigned width) {
+    return width >= 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+}
+
+}  // namespace detail
+
+template<typename T>
+class PackedRecord {
+    using Fields = std::remove_cvref_t<decltype(T::fields)>;
+    static constexpr size_t fieldCount = std::tuple_size_v<Fields>;
+
+    template<size_t I>
+    using member_t = typename std::tuple_element_t<I, Fields>::type;
+
+    template<size_t I>
+    static constexpr unsigned widthOf() {
+        if constexpr (detail::Packable<member_t<I>>) {
+            return detail::PackedCodec<member_t<I>>::width;
+        } else {
+            return 0;
+        }
+    }
+
+    struct Layout {
+        std::array<unsigned, fieldCount> offset{};
+        std::array<unsigned, fieldCount> width{};
+        unsigned totalBits = 0;
+    };
+
+    static constexpr Layout layout = [] {
+        Layout l;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            ((l.offset[I] = l.totalBits, l.width[I] = widthOf<I>(), l.totalBits += l.width[I]), ...);
+        }(std::make_index_sequence<fieldCount>{});
+        return l;
+    }();
+
+    static constexpr size_t wordCount = layout.totalBits == 0 ? 1 : (layout.totalBits + 63) / 64;
+
+    // Position of Member in T::fields
+    template<auto Member>
+    static consteval size_t indexOf() { return fieldIndex<T, Member>(); }
+
+public:
+    PackedRecord() = default;
+
+    explicit PackedRecord(const T& obj) { pack(obj); }
+
+    static constexpr size_t bits() { return layout.totalBits; }
+    static constexpr size_t words() { return wordCount; }
+
+    template<auto Member>
+    auto get() const {
+        constexpr size_t I = indexOf<Member>();
+        static_assert(I < fieldCount, "Member is not listed in T::fields");
+        static_assert(detail::Packable<member_t<I>>, "Member type is not packable");
+        return detail::PackedCodec<member_t<I>>::decode(read(layout.offset[I], layout.width[I]));
+    }
+
+    // Throws std::out_of_range for a BoundedInt outside its bounds
+    template<auto Member>
+    void set(const member_t<indexOf<Member>()>& value) {
+        constexpr size_t I = indexOf<Member>();
+        static_assert(detail::Packable<member_t<I>>, "Member type is not packable");
+        write(layout.offset[I], layout.width[I], detail::PackedCodec<member_t<I>>::encode(value));
+    }
+
+    // Packs every packable field of obj; all-or-nothing
+    void pack(const T& obj) {
+        PackedRecord next;
+        std::apply([&](auto&&... fields) { (next.packField(obj, fields), ...); }, T::fields);
+        words_ = next.words_;
+    }
+
+    T unpack() const {
+        T obj{};
+        std::apply([&](auto&&... fields) { (unpackField(obj, fields), ...); }, T::fields);
+        return obj;
+    }
+
+    std::span<const uint64_t, wordCount> data() const { return words_; }
+
+    friend bool operator==(const PackedRecord&, const PackedRecord&) = default;
+
+private:
+    std::array<uint64_t, wordCount> words_{};
+
+    template<typename F>
+    void packField(const T& obj, const F& field) {
+        using M = typename F::type;
+        if constexpr (detail::Packable<M>) {
+            constexpr size_t I = indexOf<F::memberPtr>();
+            write(layout.offset[I], layout.width[I], detail::PackedCodec<M>::encode(obj.*field.memberPtr));
+        }
+    }
+
+    template<typename F>
+    void unpackField(T& obj, const F& field) const {
+        using M = typename F::type;
+        if constexpr (detail::Packable<M>) {
+            constexpr size_t I = indexOf<F::memberPtr>();
+            obj.*field.memberPtr = detail::PackedCodec<M>::decode(read(layout.offset[I], layout.width[I]));
+        }
+    }
+
+    uint64_t read(unsigned offset, unsigned width) const {
+        if (width == 0) return 0;
+        size_t word = offset / 64;
+        unsigned shift = offset % 64;
+        uint64_t bits = words_[word] >> shift;
+        if (shift + width > 64) {
+            bits |= words_[word + 1] << (64 - shift);
+        }
+        return bits & detail::lowBits(width);
+    }
+
+    void write(unsigned offset, unsigned width, uint64_t value) {
+        if (width == 0) return;
+        uint64_t mask = detail::lowBits(width);
+        value &= mask;
+        size_t word = offset / 64;
+        unsigned shift = offset % 64;
+        words_[word] = (words_[word] & ~(mask << shift)) | (value << shift);
+        if (shift + width > 64) {
+            unsigned low = 64 - shift;
+            words_[word + 1] = (words_[word + 1] & ~(mask >> low)) | (value >> low);
+        }
+    }
+};
+
+}  // namespace meta
@@ -0,0 +1,118 @@
+#include "meta.h"
+#include "bounded.h"
+#include "paths.h"
+#include <iostream>
+
+// ============================================================================
+// NESTED STRUCTS
+// ============================================================================
+
+struct DatabaseConfig {
+    std::string host;
+    meta::BoundedInt<1, 65535> port{5432};
+    std::string database;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&DatabaseConfig::host>("host", "Database host", meta::RequiredField),
+        meta::Field<&DatabaseConfig::port>("port", "Database port", meta::OptionalField),
+        meta::Field<&DatabaseConfig::database>("database", "Database name", meta::RequiredField)
+    };
+};
+
+struct AppConfig {
+    std::string app_name;
+    int max_connections = 100;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&AppConfig::app_name>("app_name", "Application name", meta::RequiredField),
+        meta::Field<&AppConfig::max_connections>("max_connections", "Connection limit", meta::OptionalField)
+    };
+};
+
+struct ServiceConfig {
+    std::string service_name;
+    DatabaseConfig db;
+    AppConfig app;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&ServiceConfig::service_name>("service_name", "Service identifier", meta::RequiredField),
+        meta::Field<&ServiceConfig::db>("database", "Database configuration", meta::RequiredField),
+        meta::Field<&ServiceConfig::app>("application", "Application configuration", meta::RequiredField)
+    };
+};
+
+using Paths = meta::PathTable<ServiceConfig>;
+
+// Resolved by the compiler
+static_assert(Paths::size == 8);
+static_assert(Paths::find("database.port") == 3);
+static_assert(!Paths::find("database.user"));
+static_assert(meta::FieldPath<ServiceConfig, std::index_sequence<2, 1>>::value == "application.max_connections");
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Nested Paths ===\n\n";
+
+    // ========================================
+    // Nested structs parse as nested mappings
+    // ========================================
+    std::cout << "--- Valid Config ---\n";
+
+    YAML::Node good = YAML::Load(R"(
+        service_name: billing
+        database:
+          host: db1.internal
+          port: 6432
+          database: ledger
+        application:
+          app_name: billing-api
+    )");
+
+    auto [config, result] = meta::fromYamlWithValidation<ServiceConfig>(good);
+    if (config) {
+        std::cout << "✓ Parsed:\n" << meta::toString(*config);
+    }
+
+    // ========================================
+    // Errors carry the full path
+    // ========================================
+    std::cout << "\n--- Invalid Config ---\n";
+
+    YAML::Node bad = YAML::Load(R"(
+        service_name: billing
+        database:
+          port: 70000
+          database: ledger
+        application: billing-api
+    )");
+
+    auto [config2, result2] = meta::fromYamlWithValidation<ServiceConfig>(bad);
+    for (const auto& [field, msg] : result2.errors) {
+        std::cout << "  ✗ " << field << ": " << msg << "\n";
+    }
+
+    // ========================================
+    // Path table
+    // ========================================
+    std::cout << "\n--- Path Table ---\n";
+
+    for (auto path : Paths::paths) {
+        std::cout << "  " << path << "\n";
+    }
+
+    meta::get<"database.port">(*config) = 7000;
+    std::cout << "\nget<\"database.port\"> = " << meta::get<"database.port">(*config).value() << "\n";
+
+    for (std::string_view path : {"application.app_name", "database.user"}) {
+        bool found = Paths::visit(*config, path, [&](const auto& member) {
+            std::cout << "visit(\"" << path << "\") = " << meta::dispatchToString(member) << "\n";
+        });
+        if (!found) std::cout << "visit(\"" << path << "\"): no such field\n";
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
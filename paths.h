@@ -0,0 +1,163 @@
+#pragma once
+
+#include "meta.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace meta {
+
+// ============================================================================
+// PATH TABLE - every dotted path of a type, resolved at compile time
+// ============================================================================
+//
+// Nested HasFields members are walked into, so for
+//
+//   struct ServiceConfig { std::string service_name; DatabaseConfig db; ... };
+//
+// PathTable<ServiceConfig> lists "service_name", "database",
+// "database.host", "database.port", ... (parents before children, in
+// T::fields order). Lookups never touch the YAML or build strings:
+//
+//   meta::get<"database.port">(config)          // plain member access
+//   PathTable<ServiceConfig>::find("database.port")  // O(1) hashed lookup
+//   PathTable<ServiceConfig>::visit(config, path, f) // f(member) by name
+//
+
+namespace detail {
+
+template<typename... Paths>
+struct PathList {};
+
+template<typename... Lists>
+struct path_concat { using type = PathList<>; };
+
+template<typename... A>
+struct path_concat<PathList<A...>> { using type = PathList<A...>; };
+
+template<typename... A, typename... B, typename... Rest>
+struct path_concat<PathList<A...>, PathList<B...>, Rest...> {
+    using type = typename path_concat<PathList<A..., B...>, Rest...>::type;
+};
+
+// Every field chain below the struct at Path, parents before children
+template<typename Root, typename Path>
+struct CollectPaths {
+    using T = field_path_t<Root, Path>;
+
+    template<size_t I>
+    static auto one() {
+        using Child = path_append_t<Path, I>;
+        if constexpr (NestedFields<field_path_t<Root, Child>>) {
+            return typename path_concat<PathList<Child>, typename CollectPaths<Root, Child>::type>::type{};
+        } else {
+            return PathList<Child>{};
+        }
+    }
+
+    template<size_t... I>
+    static auto all(std::index_sequence<I...>) {
+        return typename path_concat<decltype(one<I>())...>::type{};
+    }
+
+    using type = decltype(all(std::make_index_sequence<field_count_v<T>>{}));
+};
+
+constexpr uint64_t pathHash(std::string_view path) {
+    uint64_t hash = 14695981039346656037ull;  // FNV-1a
+    for (char c : path) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+template<HasFields T, typename List>
+class PathTableImpl;
+
+template<HasFields T, typename... Paths>
+class PathTableImpl<T, PathList<Paths...>> {
+public:
+    static constexpr size_t size = sizeof...(Paths);
+
+    // Dotted names, in table order
+    static constexpr std::array<std::string_view, size> paths{FieldPath<T, Paths>::value...};
+
+    // Field-index chain of entry K, e.g. std::index_sequence<1, 0>
+    template<size_t K>
+    using path_at = std::tuple_element_t<K, std::tuple<Paths...>>;
+
+    // Member type at entry K
+    template<size_t K>
+    using type_at = field_path_t<T, path_at<K>>;
+
+    // Entry for a dotted path, or nullopt if T has no such field
+    static constexpr std::optional<size_t> find(std::string_view path) {
+        size_t slot = pathHash(path) & (kSlots - 1);
+        while (slots_[slot] != 0) {
+            size_t index = slots_[slot] - 1u;
+            if (paths[index] == path) return index;
+            slot = (slot + 1) & (kSlots - 1);
+        }
+        return std::nullopt;
+    }
+
+    // Calls f with the member a runtime path names; false if there is none.
+    // f must accept every member type of T, nested structs included.
+    template<typename Obj, typename F>
+    static bool visit(Obj& obj, std::string_view path, F&& f) {
+        auto index = find(path);
+        if (!index) return false;
+        visitors<Obj, std::remove_reference_t<F>>[*index](obj, f);
+        return true;
+    }
+
+private:
+    // Open addressing at <= 50% load; slot holds entry index + 1, 0 = empty
+    static constexpr size_t kSlots = std::bit_ceil(2 * size + 1);
+
+    static constexpr auto slots_ = [] {
+        std::array<uint16_t, kSlots> slots{};
+        for (size_t index = 0; index < size; index++) {
+            size_t slot = pathHash(paths[index]) & (kSlots - 1);
+            while (slots[slot] != 0) slot = (slot + 1) & (kSlots - 1);
+            slots[slot] = static_cast<uint16_t>(index + 1);
+        }
+        return slots;
+    }();
+
+    template<typename Obj, typename F>
+    static constexpr std::array<void (*)(Obj&, F&), size> visitors{
+        [](Obj& obj, F& f) { f(FieldPath<T, Paths>::get(obj)); }...};
+};
+
+}  // namespace detail
+
+template<HasFields T>
+using PathTable = detail::PathTableImpl<T, typename detail::CollectPaths<T, std::index_sequence<>>::type>;
+
+// Table entry for a path known at compile time; unknown paths do not compile
+template<HasFields T, FixedString Path>
+consteval size_t pathIndex() {
+    auto index = PathTable<T>::find(Path.view());
+    if (!index) throw "Path does not name a field of T";
+    return *index;
+}
+
+template<FixedString Path, HasFields T>
+constexpr auto& get(T& obj) {
+    using Table = PathTable<T>;
+    return FieldPath<T, typename Table::template path_at<pathIndex<T, Path>()>>::get(obj);
+}
+
+template<FixedString Path, HasFields T>
+constexpr const auto& get(const T& obj) {
+    using Table = PathTable<T>;
+    return FieldPath<T, typename Table::template path_at<pathIndex<T, Path>()>>::get(obj);
+}
+
+}  // namespace meta
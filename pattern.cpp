@@ -0,0 +1,87 @@
+#include "meta.h"
+#include "bounded.h"
+#include "pattern.h"
+#include <iostream>
+
+// ============================================================================
+// PATTERNS
+// ============================================================================
+
+using EmailPattern = meta::PatternConstraint<"[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\\.[a-zA-Z]{2,}">;
+using HostnamePattern = meta::PatternConstraint<"[a-z0-9]([a-z0-9-]*[a-z0-9])?(\\.[a-z0-9]([a-z0-9-]*[a-z0-9])?)*">;
+using VersionPattern = meta::PatternConstraint<"\\d+\\.\\d+\\.\\d+(-[0-9A-Za-z.]+)?">;
+
+// Checked by the compiler, not at startup
+static_assert(EmailPattern::validate("ops@example.com"));
+static_assert(!HostnamePattern::validate("-bad-.example.com"));
+
+// ============================================================================
+// STRUCT WITH PATTERN-CONSTRAINED FIELDS
+// ============================================================================
+
+struct Account {
+  std::string email;
+  meta::BoundedString<1, 253> host;
+  std::string version;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Account::email, EmailPattern>("email", "Contact address", meta::RequiredField),
+        meta::Field<&Account::host, HostnamePattern>("host", "Home server", meta::RequiredField),
+        meta::Field<&Account::version, VersionPattern>("version", "Client version", meta::OptionalField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Pattern Constraints ===\n\n";
+
+    // ========================================
+    // Valid input
+    // ========================================
+    std::cout << "--- Valid Account ---\n";
+
+    YAML::Node good = YAML::Load(R"(
+        email: ops@example.com
+        host: mail.example.com
+        version: 2.14.1-rc.1
+    )");
+
+    auto [account, result] = meta::fromYamlWithValidation<Account>(good);
+    if (account) {
+        std::cout << "✓ Parsed:\n" << meta::toString(*account);
+    }
+
+    // ========================================
+    // Invalid input: errors come back per field
+    // ========================================
+    std::cout << "\n--- Invalid Account ---\n";
+
+    YAML::Node bad = YAML::Load(R"(
+        email: ops@localhost
+        host: mail..example.com
+        version: v2
+    )");
+
+    auto [account2, result2] = meta::fromYamlWithValidation<Account>(bad);
+    if (!account2) {
+        for (const auto& [field, error] : result2.errors) {
+            std::cout << "  ✗ " << field << ": " << error << "\n";
+        }
+    }
+
+    // ========================================
+    // Direct use
+    // ========================================
+    std::cout << "\n--- Direct Matching ---\n";
+
+    for (std::string_view host : {"db1.internal", "DB1.internal", "a-b-c.d"}) {
+        std::cout << (HostnamePattern::validate(host) ? "  ✓ " : "  ✗ ") << host << "\n";
+    }
+    std::cout << "  (hostname DFA: " << sizeof(HostnamePattern::dfa) << " bytes)\n";
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,559 @@
+#pragma once
+#include "meta.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// PATTERN CONSTRAINT - regex compiled to a DFA at compile time
+// ============================================================================
+//
+// PatternConstraint<"..."> checks that a whole string matches a regular
+// expression. The pattern is parsed, turned into a Glushkov position
+// automaton and then into a DFA entirely at compile time; a bad pattern is
+// a compile error. Matching is one table lookup per byte: linear time, no
+// allocation, no backtracking.
+//
+// Supported syntax (bytes, not code points):
+//   literals, .  [abc] [a-z] [^...]  \d \w \s \D \W \S  \n \t \r  \x (escaped x)
+//   ( )  (?: )  |  *  +  ?  {m}  {m,}  {m,n}
+//   ^ and $ are accepted at the ends and ignored (matching is always whole-string)
+//
+// Counted repetitions are expanded, so something like [a-z0-9-]{0,61} costs
+// 61 positions worth of compile time; very large patterns may need a higher
+// -fconstexpr-ops-limit.
+//
+// Usage (any string-like field, see Field):
+//   meta::Field<&User::email, meta::PatternConstraint<"[a-z0-9._%+-]+@[a-z0-9.-]+\\.[a-z]{2,}">>(
+//       "email", "Contact address", meta::RequiredField)
+//
+
+namespace detail::pattern {
+
+struct CharSet {
+    std::array<uint64_t, 4> bits{};
+
+    constexpr void set(unsigned char c) { bits[c / 64] |= uint64_t{1} << (c % 64); }
+    constexpr bool test(unsigned char c) const { return (bits[c / 64] >> (c % 64)) & 1; }
+
+    constexpr void setRange(unsigned char lo, unsigned char hi) {
+        for (unsigned c = lo; c <= hi; c++) set(static_cast<unsigned char>(c));
+    }
+
+    constexpr void merge(const CharSet& other) {
+        for (size_t i = 0; i < 4; i++) bits[i] |= other.bits[i];
+    }
+
+    constexpr void invert() {
+        for (auto& w : bits) w = ~w;
+    }
+};
+
+enum class NodeKind : uint8_t {
+    Empty,
+    Atom,
+    Concat,
+    Alt,
+    Star,
+    Plus,
+    Optional,
+    Repeat
+};
+
+struct Node {
+    NodeKind kind = NodeKind::Empty;
+    int left = -1;
+    int right = -1;
+    int atom = -1;
+    int min = 0;
+    int max = 0;  // -1: unbounded
+};
+
+// Recursive-descent parser producing an AST of Nodes over CharSet atoms
+struct Parser {
+    std::string_view src;
+    size_t pos = 0;
+    std::vector<Node> nodes;
+    std::vector<CharSet> atoms;
+
+    constexpr explicit Parser(std::string_view pattern) : src(pattern) {
+        if (!src.empty() && src.front() == '^') src.remove_prefix(1);
+        if (!src.empty() && src.back() == '$' && !(src.size() >= 2 && src[src.size() - 2] == '\\')) {
+            src.remove_suffix(1);
+        }
+    }
+
+    constexpr int parse() {
+        int root = parseAlt();
+        if (pos != src.size()) throw "pattern: unmatched ')'";
+        return root;
+    }
+
+    constexpr bool atEnd() const { return pos >= src.size(); }
+    constexpr char peek() const { return src[pos]; }
+
+    constexpr int add(Node n) {
+        nodes.push_back(n);
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    constexpr int addAtom(const CharSet& set) {
+        atoms.push_back(set);
+        Node n;
+        n.kind = NodeKind::Atom;
+        n.atom = static_cast<int>(atoms.size()) - 1;
+        return add(n);
+    }
+
+    constexpr int parseAlt() {
+        int left = parseConcat();
+        while (!atEnd() && peek() == '|') {
+            pos++;
+            Node n;
+            n.kind = NodeKind::Alt;
+            n.left = left;
+            n.right = parseConcat();
+            left = add(n);
+        }
+        return left;
+    }
+
+    constexpr int parseConcat() {
+        int left = -1;
+        while (!atEnd() && peek() != '|' && peek() != ')') {
+            int right = parseRepeat();
+            if (left < 0) {
+                left = right;
+            } else {
+                Node n;
+                n.kind = NodeKind::Concat;
+                n.left = left;
+                n.right = right;
+                left = add(n);
+            }
+        }
+        return left < 0 ? add(Node{}) : left;
+    }
+
+    constexpr int parseNumber() {
+        if (atEnd() || peek() < '0' || peek() > '9') throw "pattern: expected a number in {}";
+        int value = 0;
+        while (!atEnd() && peek() >= '0' && peek() <= '9') {
+            value = value * 10 + (peek() - '0');
+            if (value > 1000) throw "pattern: repetition count too large";
+            pos++;
+        }
+        return value;
+    }
+
+    constexpr int parseRepeat() {
+        int atom = parseAtom();
+        while (!atEnd()) {
+            Node n;
+            n.left = atom;
+            char c = peek();
+            if (c == '*') {
+                n.kind = NodeKind::Star;
+            } else if (c == '+') {
+                n.kind = NodeKind::Plus;
+            } else if (c == '?') {
+                n.kind = NodeKind::Optional;
+            } else if (c == '{') {
+                pos++;
+                n.kind = NodeKind::Repeat;
+                n.min = parseNumber();
+                n.max = n.min;
+                if (!atEnd() && peek() == ',') {
+                    pos++;
+                    n.max = (!atEnd() && peek() == '}') ? -1 : parseNumber();
+                }
+                if (atEnd() || peek() != '}') throw "pattern: unterminated {}";
+                if (n.max >= 0 && n.max < n.min) throw "pattern: {m,n} with n < m";
+            } else {
+                break;
+            }
+            pos++;
+            atom = add(n);
+        }
+        return atom;
+    }
+
+    // \d, \w, \s and friends; anything else is the escaped byte itself
+    constexpr CharSet parseEscape() {
+        if (atEnd()) throw "pattern: trailing backslash";
+        char c = src[pos++];
+        CharSet set;
+        switch (c) {
+            case 'd': case 'D':
+                set.setRange('0', '9');
+                break;
+            case 'w': case 'W':
+                set.setRange('a', 'z');
+                set.setRange('A', 'Z');
+                set.setRange('0', '9');
+                set.set('_');
+                break;
+            case 's': case 'S':
+                for (char ws : {' ', '\t', '\n', '\r', '\f', '\v'}) set.set(static_cast<unsigned char>(ws));
+                break;
+            case 'n': set.set('\n'); return set;
+            case 't': set.set('\t'); return set;
+            case 'r': set.set('\r'); return set;
+            default:
+                set.set(static_cast<unsigned char>(c));
+                return set;
+        }
+        if (c == 'D' || c == 'W' || c == 'S') set.invert();
+        return set;
+    }
+
+    constexpr CharSet parseClass() {
+        CharSet set;
+        bool negate = false;
+        if (!atEnd() && peek() == '^') {
+            negate = true;
+            pos++;
+        }
+        bool first = true;
+        while (true) {
+            if (atEnd()) throw "pattern: unterminated []";
+            char c = src[pos];
+            if (c == ']' && !first) break;
+            first = false;
+            pos++;
+            if (c == '\\') {
+                CharSet escaped = parseEscape();
+                set.merge(escaped);
+                continue;
+            }
+            if (pos + 1 < src.size() && src[pos] == '-' && src[pos + 1] != ']') {
+                char hi = src[pos + 1];
+                if (hi == '\\') throw "pattern: escaped range bounds are not supported";
+                if (static_cast<unsigned char>(hi) < static_cast<unsigned char>(c)) {
+                    throw "pattern: reversed range in []";
+                }
+                set.setRange(static_cast<unsigned char>(c), static_cast<unsigned char>(hi));
+                pos += 2;
+            } else {
+                set.set(static_cast<unsigned char>(c));
+            }
+        }
+        pos++;  // ']'
+        if (negate) set.invert();
+        return set;
+    }
+
+    constexpr int parseAtom() {
+        char c = src[pos++];
+        switch (c) {
+            case '(': {
+                if (pos + 1 < src.size() && src[pos] == '?' && src[pos + 1] == ':') pos += 2;
+                int inner = parseAlt();
+                if (atEnd() || peek() != ')') throw "pattern: missing ')'";
+                pos++;
+                return inner;
+            }
+            case '[':
+                return addAtom(parseClass());
+            case '.': {
+                CharSet any;
+                any.invert();
+                any.bits[0] &= ~(uint64_t{1} << '\n');
+                return addAtom(any);
+            }
+            case '\\':
+                return addAtom(parseEscape());
+            case '*': case '+': case '?': case '{':
+                throw "pattern: quantifier without an operand";
+            default: {
+                CharSet literal;
+                literal.set(static_cast<unsigned char>(c));
+                return addAtom(literal);
+            }
+        }
+    }
+};
+
+// Dynamic bitset over positions (compile-time only)
+struct Bits {
+    std::vector<uint64_t> words;
+
+    constexpr explicit Bits(size_t n = 0) : words((n + 63) / 64, 0) {}
+
+    constexpr void set(size_t i) { words[i / 64] |= uint64_t{1} << (i % 64); }
+    constexpr bool test(size_t i) const { return (words[i / 64] >> (i % 64)) & 1; }
+
+    constexpr void merge(const Bits& other) {
+        for (size_t i = 0; i < words.size(); i++) words[i] |= other.words[i];
+    }
+
+    constexpr void intersect(const Bits& other) {
+        for (size_t i = 0; i < words.size(); i++) words[i] &= other.words[i];
+    }
+
+    constexpr bool empty() const {
+        for (uint64_t w : words) {
+            if (w != 0) return false;
+        }
+        return true;
+    }
+
+    constexpr uint64_t hash() const {
+        uint64_t h = 0;
+        for (uint64_t w : words) h = (h ^ w) * 0x9E3779B97F4A7C15ull;
+        return h;
+    }
+
+    constexpr bool operator==(const Bits&) const = default;
+};
+
+// Glushkov construction: one position per atom occurrence, with first /
+// last / follow sets. Position `positions` is a virtual start position
+// whose follow set is the automaton's first set.
+struct Glushkov {
+    const Parser& parser;
+    size_t positions;
+    std::vector<CharSet> classes;
+    std::vector<Bits> follow;
+
+    struct Info {
+        bool nullable;
+        Bits first;
+        Bits last;
+    };
+
+    constexpr Glushkov(const Parser& p, size_t count)
+        : parser(p), positions(count), follow(count + 1, Bits(count + 1)) {}
+
+    constexpr Info empty() const { return Info{true, Bits(positions + 1), Bits(positions + 1)}; }
+
+    constexpr void link(const Bits& from, const Bits& to) {
+        for (size_t p = 0; p < positions; p++) {
+            if (from.test(p)) follow[p].merge(to);
+        }
+    }
+
+    constexpr Info concat(Info a, const Info& b) {
+        link(a.last, b.first);
+        if (a.nullable) a.first.merge(b.first);
+        Bits last = b.last;
+        if (b.nullable) last.merge(a.last);
+        return Info{a.nullable && b.nullable, a.first, last};
+    }
+
+    constexpr Info loop(Info a, bool nullable) {
+        link(a.last, a.first);
+        a.nullable = a.nullable || nullable;
+        return a;
+    }
+
+    constexpr Info build(int index) {
+        const Node& n = parser.nodes[static_cast<size_t>(index)];
+        switch (n.kind) {
+            case NodeKind::Empty:
+                return empty();
+            case NodeKind::Atom: {
+                size_t p = classes.size();
+                classes.push_back(parser.atoms[static_cast<size_t>(n.atom)]);
+                Info info{false, Bits(positions + 1), Bits(positions + 1)};
+                info.first.set(p);
+                info.last.set(p);
+                return info;
+            }
+            case NodeKind::Concat: {
+                Info a = build(n.left);
+                return concat(a, build(n.right));
+            }
+            case NodeKind::Alt: {
+                Info a = build(n.left);
+                Info b = build(n.right);
+                a.first.merge(b.first);
+                a.last.merge(b.last);
+                a.nullable = a.nullable || b.nullable;
+                return a;
+            }
+            case NodeKind::Star:
+                return loop(build(n.left), true);
+            case NodeKind::Plus:
+                return loop(build(n.left), false);
+            case NodeKind::Optional: {
+                Info a = build(n.left);
+                a.nullable = true;
+                return a;
+            }
+            case NodeKind::Repeat: {
+                // a{m,n} -> a...a (m times) a? ... a? (n - m times)
+                // a{m,}  -> a...a (m - 1 times) a+, or a* when m == 0
+                Info info = empty();
+                if (n.max < 0) {
+                    for (int i = 0; i + 1 < n.min; i++) info = concat(info, build(n.left));
+                    return concat(info, loop(build(n.left), n.min == 0));
+                }
+                for (int i = 0; i < n.min; i++) info = concat(info, build(n.left));
+                for (int i = n.min; i < n.max; i++) {
+                    Info optional = build(n.left);
+                    optional.nullable = true;
+                    info = concat(info, optional);
+                }
+                return info;
+            }
+        }
+        return empty();
+    }
+};
+
+constexpr size_t countPositions(const Parser& parser, int index) {
+    const Node& n = parser.nodes[static_cast<size_t>(index)];
+    switch (n.kind) {
+        case NodeKind::Empty:
+            return 0;
+        case NodeKind::Atom:
+            return 1;
+        case NodeKind::Concat:
+        case NodeKind::Alt:
+            return countPositions(parser, n.left) + countPositions(parser, n.right);
+        case NodeKind::Star:
+        case NodeKind::Plus:
+        case NodeKind::Optional:
+            return countPositions(parser, n.left);
+        case NodeKind::Repeat: {
+            size_t copies = n.max < 0 ? static_cast<size_t>(n.min == 0 ? 1 : n.min) : static_cast<size_t>(n.max);
+            return copies * countPositions(parser, n.left);
+        }
+    }
+    return 0;
+}
+
+inline constexpr size_t kMaxStates = 4096;
+
+// Subset construction over byte classes (bytes no position tells apart).
+// State 0 is the dead state, state 1 the start state.
+struct DfaBuilder {
+    std::array<uint8_t, 256> classOf{};
+    size_t classCount = 0;
+    std::vector<uint16_t> next;  // states x classCount
+    std::vector<bool> accepting;
+
+    constexpr explicit DfaBuilder(std::string_view pattern) {
+        Parser parser(pattern);
+        int root = parser.parse();
+        size_t positions = countPositions(parser, root);
+        if (positions > 2048) throw "pattern: too many positions";
+
+        Glushkov g(parser, positions);
+        auto info = g.build(root);
+        size_t start = positions;
+        g.follow[start] = info.first;
+        Bits last = info.last;
+        if (info.nullable) last.set(start);
+
+        // Positions accepting each byte, then bytes grouped by that set
+        std::vector<Bits> byByte(256, Bits(positions + 1));
+        for (size_t p = 0; p < positions; p++) {
+            for (unsigned c = 0; c < 256; c++) {
+                if (g.classes[p].test(static_cast<unsigned char>(c))) byByte[c].set(p);
+            }
+        }
+        std::vector<Bits> classMasks;
+        for (unsigned c = 0; c < 256; c++) {
+            size_t k = 0;
+            while (k < classMasks.size() && !(classMasks[k] == byByte[c])) k++;
+            if (k == classMasks.size()) classMasks.push_back(byByte[c]);
+            classOf[c] = static_cast<uint8_t>(k);
+        }
+        classCount = classMasks.size();
+
+        std::vector<Bits> states;
+        std::vector<uint64_t> hashes;
+        states.push_back(Bits(positions + 1));  // dead
+        Bits startSet(positions + 1);
+        startSet.set(start);
+        states.push_back(startSet);
+        for (const auto& state : states) hashes.push_back(state.hash());
+
+        for (size_t s = 0; s < states.size(); s++) {
+            Bits reachable(positions + 1);
+            for (size_t p = 0; p <= positions; p++) {
+                if (states[s].test(p)) reachable.merge(g.follow[p]);
+            }
+            Bits acc = states[s];
+            acc.intersect(last);
+            accepting.push_back(!acc.empty());
+
+            for (size_t k = 0; k < classCount; k++) {
+                Bits target = reachable;
+                target.intersect(classMasks[k]);
+                uint64_t h = target.hash();
+                size_t t = 0;
+                while (t < states.size() && !(hashes[t] == h && states[t] == target)) t++;
+                if (t == states.size()) {
+                    if (states.size() == kMaxStates) throw "pattern: DFA too large";
+                    states.push_back(target);
+                    hashes.push_back(h);
+                }
+                next.push_back(static_cast<uint16_t>(t));
+            }
+        }
+    }
+
+    constexpr size_t stateCount() const { return accepting.size(); }
+};
+
+template<size_t States, size_t Classes>
+struct Dfa {
+    std::array<uint8_t, 256> classOf{};
+    std::array<uint16_t, States * Classes> next{};
+    std::array<bool, States> accepting{};
+
+    constexpr bool matches(std::string_view s) const {
+        size_t state = 1;
+        for (char c : s) {
+            state = next[state * Classes + classOf[static_cast<unsigned char>(c)]];
+            if (state == 0) return false;
+        }
+        return accepting[state];
+    }
+};
+
+struct DfaShape {
+    size_t states;
+    size_t classes;
+};
+
+template<FixedString Pattern>
+consteval DfaShape shapeOf() {
+    DfaBuilder b(Pattern.view());
+    return DfaShape{b.stateCount(), b.classCount};
+}
+
+template<FixedString Pattern, DfaShape Shape>
+consteval Dfa<Shape.states, Shape.classes> compile() {
+    DfaBuilder b(Pattern.view());
+    Dfa<Shape.states, Shape.classes> dfa;
+    dfa.classOf = b.classOf;
+    for (size_t i = 0; i < b.next.size(); i++) dfa.next[i] = b.next[i];
+    for (size_t i = 0; i < b.accepting.size(); i++) dfa.accepting[i] = b.accepting[i];
+    return dfa;
+}
+
+}  // namespace detail::pattern
+
+template<FixedString Pattern>
+struct PatternConstraint {
+    static constexpr auto dfa = detail::pattern::compile<Pattern, detail::pattern::shapeOf<Pattern>()>();
+
+    static constexpr std::string_view pattern() { return Pattern.view(); }
+
+    static constexpr bool validate(std::string_view value) { return dfa.matches(value); }
+
+    static std::string error(std::string_view value) {
+        return "'" + std::string(value) + "' does not match pattern " + std::string(Pattern.view());
+    }
+};
+
+}  // namespace meta
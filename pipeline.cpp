@@ -0,0 +1,117 @@
+#include "meta.h"
+#include "bounded.h"
+#include "pipeline.h"
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// ============================================================================
+// RECORD TYPE
+// ============================================================================
+
+struct Location {
+    std::string city;
+    std::string country;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Location::city>("city", "City", meta::RequiredField),
+        meta::Field<&Location::country>("country", "ISO country code", meta::RequiredField)
+    };
+};
+
+struct Customer {
+    std::string email;
+    meta::BoundedInt<0, 150> age;
+    bool active = true;
+    Location location;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Customer::email>("email", "Contact address", meta::RequiredField),
+        meta::Field<&Customer::age>("age", "Age in years", meta::RequiredField),
+        meta::Field<&Customer::active>("active", "Account enabled", meta::OptionalField),
+        meta::Field<&Customer::location>("location", "Home address", meta::OptionalField)
+    };
+};
+
+// Export generated as it is read; every 1000th record has an invalid age
+class CustomerExport : public std::streambuf {
+public:
+    explicit CustomerExport(size_t count) : count_(count) {}
+
+protected:
+    int_type underflow() override {
+        if (next_ == count_) return traits_type::eof();
+        size_t age = next_ % 1000 == 999 ? 200 : next_ % 90;
+        text_ = "- email: Customer" + std::to_string(next_) + "@Example.COM\n"
+                "  age: " + std::to_string(age) + "\n"
+                "  location:\n"
+                "    city: \"Saint-\\\"Quoted\\\" Town\"\n"
+                "    country: fr\n";
+        next_++;
+        setg(text_.data(), text_.data(), text_.data() + text_.size());
+        return traits_type::to_int_type(text_[0]);
+    }
+
+private:
+    size_t count_;
+    size_t next_ = 0;
+    std::string text_;
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Conversion Pipeline ===\n\n";
+
+    CustomerExport source(20000);
+    std::istream in(&source);
+    std::ostringstream out;
+
+    size_t rejected = 0;
+    meta::Pipeline<Customer> pipeline({.parsers = 3, .validators = 2, .queueCapacity = 256});
+    pipeline
+        .transform([](Customer& c, meta::ValidationResult&) {
+            std::transform(c.email.begin(), c.email.end(), c.email.begin(),
+                           [](unsigned char ch) { return std::tolower(ch); });
+        })
+        .onRejected([&](size_t index, const meta::ValidationResult& result) {
+            if (rejected++ < 2) {
+                std::cout << "✗ record " << index << " " << result.errors.front().first << ": "
+                          << result.errors.front().second << "\n";
+            }
+        });
+
+    auto result = pipeline.run(in, out);
+    std::cout << (result.valid ? "✓" : "✗") << " input read, " << rejected << " rejected\n\n";
+
+    // ========================================
+    // Output stays in input order
+    // ========================================
+    std::istringstream lines(out.str());
+    std::string line;
+    for (int i = 0; i < 2 && std::getline(lines, line); i++) {
+        std::cout << line << "\n";
+    }
+
+    // ========================================
+    // Per-stage counters
+    // ========================================
+    auto stats = pipeline.stats();
+    std::cout << "\n" << std::left << std::setw(10) << "stage" << std::right << std::setw(8) << "workers"
+              << std::setw(8) << "items" << std::setw(10) << "busy s" << std::setw(12) << "items/s"
+              << std::setw(10) << "max queue" << "\n";
+    for (const auto& stage : stats.stages) {
+        std::cout << std::left << std::setw(10) << stage.name << std::right << std::setw(8) << stage.workers
+                  << std::setw(8) << stage.items << std::setw(10) << std::fixed << std::setprecision(3)
+                  << stage.busySeconds << std::setw(12) << std::setprecision(0) << stage.itemsPerSecond
+                  << std::setw(10) << stage.maxQueueDepth << "\n";
+    }
+    std::cout << "elapsed " << std::setprecision(3) << stats.elapsedSeconds << " s\n";
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,515 @@
+#pragma once
+
+#include "meta.h"
+#include "stream.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// PIPELINE - YAML sequence in, JSON Lines out, one stage per thread group
+// ============================================================================
+//
+//   meta::Pipeline<Event> pipeline({.parsers = 4, .validators = 2});
+//   pipeline.transform([](Event& e, meta::ValidationResult&) { e.name = lower(e.name); })
+//           .onRejected([](size_t index, const meta::ValidationResult& r) { log(index, r); });
+//   pipeline.run(yamlExport, jsonLinesOut);
+//
+//   reader     splits the top-level sequence into element text (one thread)
+//   parser     YAML text -> YAML::Node                          (parsers threads)
+//   validator  node -> T, field checks, rules, transform, JSON  (validators threads)
+//   emitter    restores input order and writes                  (the run() caller)
+//
+// Stages are joined by BoundedQueue: a full queue makes the stage feeding
+// it wait, so a slow writer throttles the reader instead of buffering the
+// whole input. Records keep their input order on output; rejected records
+// go to onRejected, also in input order, and are not written. The reader
+// stays at most queueCapacity records ahead of the emitter, so the records
+// held back for reordering are bounded as well.
+//
+// An exception escaping any stage (the input stream, transform, onRejected,
+// the output stream) stops the whole pipeline: the other stages drop what
+// they hold, every worker is joined, and run() rethrows the first one.
+// Exceptions derived from std::exception thrown while parsing, validating
+// or transforming a record only reject that record.
+//
+
+// ============================================================================
+// BOUNDED QUEUE - lock-free multi-producer / multi-consumer ring
+// ============================================================================
+
+// Dmitry Vyukov's bounded MPMC queue: each cell carries a sequence number
+// that says whose turn it is, so producers and consumers only contend on
+// their own index. Capacity is rounded up to a power of two.
+template<typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity)
+        : mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+          cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+        for (size_t i = 0; i <= mask_; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // false if the queue is full; value is left untouched then
+    bool tryPush(T& value) {
+        size_t pos = enqueue_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value.emplace(std::move(value));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // false if the queue is empty
+    bool tryPop(T& value) {
+        size_t pos = dequeue_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(*cell->value);
+        cell->value.reset();  // destroyed, not assigned: YAML::Node assignment writes through
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+    // Snapshot; may be stale by the time it is read
+    size_t sizeApprox() const {
+        size_t tail = enqueue_.load(std::memory_order_relaxed);
+        size_t head = dequeue_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        std::optional<T> value;
+    };
+
+    size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<size_t> enqueue_{0};
+    alignas(64) std::atomic<size_t> dequeue_{0};
+};
+
+// ============================================================================
+// STAGE COUNTERS
+// ============================================================================
+
+struct StageStats {
+    std::string_view name;
+    size_t workers = 0;
+    uint64_t items = 0;         // records that left the stage
+    double busySeconds = 0;     // summed over the stage's workers
+    double itemsPerSecond = 0;  // items over wall time since run() started
+    size_t queueDepth = 0;      // records waiting in the stage's input queue
+    size_t maxQueueDepth = 0;
+};
+
+struct PipelineStats {
+    std::array<StageStats, 4> stages;  // reader, parser, validator, emitter
+    double elapsedSeconds = 0;
+};
+
+namespace detail {
+
+// Spins briefly, then yields, then sleeps: a blocked stage costs little
+// once its neighbour is clearly the bottleneck
+class Backoff {
+public:
+    void wait() {
+        if (spins_ < 64) {
+            spins_++;
+        } else if (spins_ < 128) {
+            spins_++;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+private:
+    unsigned spins_ = 0;
+};
+
+struct StageCounter {
+    std::atomic<uint64_t> items{0};
+    std::atomic<uint64_t> busyNanos{0};
+    std::atomic<int64_t> queued{0};  // in the stage's input queue
+    std::atomic<int64_t> maxQueued{0};
+
+    void reset() {
+        items = 0;
+        busyNanos = 0;
+        queued = 0;
+        maxQueued = 0;
+    }
+
+    // Time spent in work counts as busy; waiting on queues does not
+    template<typename F>
+    void timed(F&& work) {
+        auto start = std::chrono::steady_clock::now();
+        work();
+        auto spent = std::chrono::steady_clock::now() - start;
+        busyNanos.fetch_add(static_cast<uint64_t>(std::chrono::nanoseconds(spent).count()),
+                            std::memory_order_relaxed);
+    }
+
+    void count() { items.fetch_add(1, std::memory_order_relaxed); }
+};
+
+// A queue plus the number of stage workers still feeding it; depth is
+// booked to the consuming stage's counter. Once `stop` is set, push drops
+// the value instead of waiting and pop reports the channel as drained.
+template<typename T>
+class Channel {
+public:
+    Channel(size_t capacity, size_t producers, StageCounter& consumer, const std::atomic<bool>& stop)
+        : queue_(capacity), producers_(producers), consumer_(consumer), stop_(stop) {}
+
+    void push(T value) {
+        Backoff backoff;
+        while (!queue_.tryPush(value)) {  // back-pressure
+            if (stop_.load(std::memory_order_acquire)) return;
+            backoff.wait();
+        }
+        int64_t depth = consumer_.queued.fetch_add(1, std::memory_order_relaxed) + 1;
+        int64_t seen = consumer_.maxQueued.load(std::memory_order_relaxed);
+        while (depth > seen && !consumer_.maxQueued.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {}
+    }
+
+    // false once every producer is done and the queue is drained
+    bool pop(T& value) {
+        Backoff backoff;
+        for (;;) {
+            if (stop_.load(std::memory_order_acquire)) return false;
+            if (take(value)) return true;
+            if (producers_.load(std::memory_order_acquire) == 0) {
+                return take(value);  // a push may have landed before the last producer left
+            }
+            backoff.wait();
+        }
+    }
+
+    void producerDone() { producers_.fetch_sub(1, std::memory_order_acq_rel); }
+
+private:
+    BoundedQueue<T> queue_;
+    std::atomic<size_t> producers_;
+    StageCounter& consumer_;
+    const std::atomic<bool>& stop_;
+
+    bool take(T& value) {
+        if (!queue_.tryPop(value)) return false;
+        consumer_.queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+};
+
+}  // namespace detail
+
+template<HasFields T, ParseMode Mode = ParseMode::CollectAll>
+class Pipeline {
+public:
+    struct Options {
+        size_t parsers = 2;
+        size_t validators = 2;
+        size_t queueCapacity = 1024;  // per queue, and records in flight, in records
+    };
+
+    // Runs after T has parsed cleanly; may rewrite the record or add errors
+    using Transform = std::function<void(T&, ValidationResult&)>;
+    using Rejected = std::function<void(size_t index, const ValidationResult&)>;
+
+    explicit Pipeline(Options options = {}) : options_(options) {
+        options_.parsers = std::max<size_t>(options_.parsers, 1);
+        options_.validators = std::max<size_t>(options_.validators, 1);
+        options_.queueCapacity = std::max<size_t>(options_.queueCapacity, 1);
+    }
+
+    Pipeline& transform(Transform f) {
+        transform_ = std::move(f);
+        return *this;
+    }
+
+    Pipeline& onRejected(Rejected f) {
+        rejected_ = std::move(f);
+        return *this;
+    }
+
+    // Blocks until the whole input is written. The returned result is only
+    // invalid if the input is not a sequence or is cut off; per-record
+    // problems go to onRejected. Rethrows the first exception that escaped
+    // a stage, after all workers have stopped.
+    ValidationResult run(std::istream& in, std::ostream& out) {
+        for (auto& counter : counters_) counter.reset();
+        startTicks_ = now();
+        finished_ = false;
+        emitted_ = 0;
+        stopped_ = false;
+        failure_ = nullptr;
+
+        detail::Channel<Text> texts(options_.queueCapacity, 1, counters_[Parser], stopped_);
+        detail::Channel<Parsed> parsed(options_.queueCapacity, options_.parsers, counters_[Validator], stopped_);
+        detail::Channel<Encoded> encoded(options_.queueCapacity, options_.validators, counters_[Emitter], stopped_);
+
+        ValidationResult streamResult;
+        std::vector<std::thread> workers;
+        try {
+            workers.emplace_back([&] { guarded([&] { readStage(in, texts, streamResult); }); });
+            for (size_t i = 0; i < options_.parsers; i++) {
+                workers.emplace_back([&] { guarded([&] { parseStage(texts, parsed); }); });
+            }
+            for (size_t i = 0; i < options_.validators; i++) {
+                workers.emplace_back([&] { guarded([&] { validateStage(parsed, encoded); }); });
+            }
+        } catch (...) {
+            fail(std::current_exception());  // a thread failed to start
+        }
+
+        guarded([&] { emitStage(encoded, out); });
+        for (auto& worker : workers) worker.join();
+
+        elapsedTicks_ = now() - startTicks_;
+        finished_ = true;
+        if (failure_) std::rethrow_exception(failure_);
+        return streamResult;
+    }
+
+    // Callable from another thread while run() is in progress
+    PipelineStats stats() const {
+        PipelineStats result;
+        int64_t elapsed = finished_ ? elapsedTicks_.load() : now() - startTicks_;
+        result.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::duration(elapsed)).count();
+
+        static constexpr std::string_view names[] = {"reader", "parser", "validator", "emitter"};
+        size_t workers[] = {1, options_.parsers, options_.validators, 1};
+        for (size_t i = 0; i < 4; i++) {
+            StageStats& stage = result.stages[i];
+            stage.name = names[i];
+            stage.workers = workers[i];
+            stage.items = counters_[i].items.load(std::memory_order_relaxed);
+            stage.busySeconds = static_cast<double>(counters_[i].busyNanos.load(std::memory_order_relaxed)) / 1e9;
+            stage.itemsPerSecond = result.elapsedSeconds > 0 ? static_cast<double>(stage.items) / result.elapsedSeconds : 0;
+            stage.queueDepth = static_cast<size_t>(std::max<int64_t>(counters_[i].queued.load(std::memory_order_relaxed), 0));
+            stage.maxQueueDepth = static_cast<size_t>(counters_[i].maxQueued.load(std::memory_order_relaxed));
+        }
+        return result;
+    }
+
+private:
+    struct Text {
+        size_t index = 0;
+        std::string text;
+    };
+
+    struct Parsed {
+        size_t index = 0;
+        YAML::Node node;
+        ValidationResult result;
+    };
+
+    struct Encoded {
+        size_t index = 0;
+        std::string line;  // JSON line, empty when rejected
+        ValidationResult result;
+    };
+
+    enum Stage { Reader, Parser, Validator, Emitter };
+
+    // Signs a worker off its output channel however the stage ends, so the
+    // next stage still drains and returns
+    template<typename C>
+    struct ProducerGuard {
+        C& channel;
+        ~ProducerGuard() { channel.producerDone(); }
+    };
+
+    Options options_;
+    Transform transform_;
+    Rejected rejected_;
+    std::array<detail::StageCounter, 4> counters_;
+    std::atomic<int64_t> startTicks_{0};
+    std::atomic<int64_t> elapsedTicks_{0};
+    std::atomic<bool> finished_{true};
+    std::atomic<size_t> emitted_{0};  // records the emitter has written or rejected
+    std::atomic<bool> stopped_{false};  // set by the first failing stage
+    std::mutex failureMutex_;
+    std::exception_ptr failure_;
+
+    static int64_t now() { return std::chrono::steady_clock::now().time_since_epoch().count(); }
+
+    // Keeps the first failure and tells every stage to wind down
+    void fail(std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock(failureMutex_);
+            if (!failure_) failure_ = std::move(error);
+        }
+        stopped_.store(true, std::memory_order_release);
+    }
+
+    template<typename F>
+    void guarded(F&& stage) {
+        try {
+            stage();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    }
+
+    void readStage(std::istream& in, detail::Channel<Text>& out, ValidationResult& streamResult) {
+        ProducerGuard done{out};
+        detail::SequenceReader reader(in);
+        size_t index = 0;
+        while (!stopped_.load(std::memory_order_acquire)) {
+            Text item;
+            bool more = false;
+            counters_[Reader].timed([&] {
+                if (auto text = reader.next()) {
+                    item = Text{index++, std::string(*text)};
+                    more = true;
+                }
+            });
+            if (!more) break;
+            counters_[Reader].count();
+
+            // Admission is gated here rather than in a later stage, where a
+            // worker waiting on the emitter could hold up the very record the
+            // emitter is waiting for
+            detail::Backoff backoff;
+            while (item.index >= emitted_.load(std::memory_order_acquire) + options_.queueCapacity) {
+                if (stopped_.load(std::memory_order_acquire)) return;
+                backoff.wait();
+            }
+            out.push(std::move(item));
+        }
+        if (!reader.error().empty()) streamResult.addError("", reader.error());
+    }
+
+    void parseStage(detail::Channel<Text>& in, detail::Channel<Parsed>& out) {
+        ProducerGuard done{out};
+        for (;;) {
+            Text item;
+            if (!in.pop(item)) break;
+            Parsed parsed;
+            counters_[Parser].timed([&] {
+                parsed.index = item.index;
+                try {
+                    ViewStreamBuf buffer(item.text);
+                    std::istream text(&buffer);
+                    parsed.node = YAML::Load(text);
+                } catch (const std::exception& e) {
+                    parsed.result.addError("", std::string("Parse error: ") + e.what());
+                }
+            });
+            counters_[Parser].count();
+            out.push(std::move(parsed));
+        }
+    }
+
+    void validateStage(detail::Channel<Parsed>& in, detail::Channel<Encoded>& out) {
+        ProducerGuard done{out};
+        for (;;) {
+            Parsed item;  // fresh each time, so popping binds rather than assigns the node
+            if (!in.pop(item)) break;
+            Encoded encoded;
+            counters_[Validator].timed([&] {
+                encoded.index = item.index;
+                encoded.result = std::move(item.result);
+                if (!encoded.result.valid) return;
+                try {
+                    auto [obj, result] = fromYamlWithValidation<T, Mode>(item.node);
+                    if (obj && transform_) transform_(*obj, result);
+                    if (obj && result.valid) appendJson(encoded.line, *obj);
+                    encoded.result = std::move(result);
+                } catch (const std::exception& e) {
+                    encoded.result.addError("", e.what());
+                }
+                if (!encoded.result.valid) encoded.line.clear();
+            });
+            counters_[Validator].count();
+            out.push(std::move(encoded));
+        }
+    }
+
+    // Records arrive out of order; hold them until their turn. The reader
+    // admits no more than queueCapacity past `next`, which bounds `waiting`.
+    void emitStage(detail::Channel<Encoded>& in, std::ostream& out) {
+        std::map<size_t, Encoded> waiting;
+        size_t next = 0;
+        Encoded item;
+        auto emit = [&](Encoded& record) {
+            counters_[Emitter].timed([&] {
+                if (record.result.valid) {
+                    record.line += '\n';
+                    out.write(record.line.data(), static_cast<std::streamsize>(record.line.size()));
+                } else if (rejected_) {
+                    rejected_(record.index, record.result);
+                }
+            });
+            counters_[Emitter].count();
+        };
+
+        while (in.pop(item)) {
+            if (item.index != next) {
+                waiting.emplace(item.index, std::move(item));
+                continue;
+            }
+            emit(item);
+            next++;
+            for (auto it = waiting.begin(); it != waiting.end() && it->first == next; it = waiting.erase(it)) {
+                emit(it->second);
+                next++;
+            }
+            emitted_.store(next, std::memory_order_release);
+        }
+    }
+};
+
+}  // namespace meta
@@ -0,0 +1,95 @@
+#include "meta.h"
+#include "bounded.h"
+#include "record_table.h"
+#include "stream.h"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+// ============================================================================
+// RECORD TYPE
+// ============================================================================
+
+struct User {
+    std::string username;
+    meta::BoundedInt<0, 150, meta::IntEncoding::Offset> age;  // one byte
+    bool active = true;
+    double balance = 0;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&User::username>("username", "Login name", meta::RequiredField),
+        meta::Field<&User::age>("age", "Age in years", meta::RequiredField),
+        meta::Field<&User::active>("active", "Account enabled", meta::OptionalField),
+        meta::Field<&User::balance>("balance", "Account balance", meta::OptionalField)
+    };
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== RecordTable ===\n\n";
+
+    // ========================================
+    // Bulk append from parseEach
+    // ========================================
+    std::cout << "--- Append ---\n";
+
+    std::ostringstream dump;
+    for (int i = 0; i < 100000; i++) {
+        dump << "- username: user" << i << "\n"
+             << "  age: " << (i == 7 ? 200 : i % 90) << "\n"
+             << "  active: " << (i % 10 != 0 ? "true" : "false") << "\n"
+             << "  balance: " << (i % 1000) * 1.5 << "\n";
+    }
+
+    meta::RecordTable<User> users;
+    users.reserve(100000);
+    auto rejected = users.append(meta::parseEach<User>(std::string_view(dump.str())));
+    users.push_back(User{"admin", 40, true, 0});
+
+    std::cout << "✓ " << users.size() << " rows\n";
+    for (const auto& [field, msg] : rejected.errors) {
+        std::cout << "✗ " << field << ": " << msg << "\n";
+    }
+
+    // ========================================
+    // Column scans touch one field only
+    // ========================================
+    std::cout << "\n--- Column Scans ---\n";
+
+    auto ages = users.column<&User::age>();
+    auto adults = std::count_if(ages.begin(), ages.end(), [](auto age) { return age.value() >= 18; });
+    std::cout << "✓ " << adults << " adults, scanning " << ages.size_bytes() / 1024 << " KiB (rows are "
+              << users.size() * sizeof(User) / 1024 << " KiB as structs)\n";
+
+    auto balances = users.column<&User::balance>();
+    double total = std::accumulate(balances.begin(), balances.end(), 0.0);
+    std::cout << "✓ total balance " << total << "\n";
+
+    auto inactive = users.where<&User::active>([](bool active) { return !active; });
+    std::cout << "✓ " << inactive.size() << " inactive, first is " << users[inactive.front()].get<&User::username>()
+              << "\n";
+
+    // ========================================
+    // Row proxies
+    // ========================================
+    std::cout << "\n--- Rows ---\n";
+
+    users[1].get<&User::active>() = false;
+    User second = users[1];
+    std::cout << "  " << second.username << ": age " << second.age.value() << ", active "
+              << std::boolalpha << second.active << "\n";
+
+    size_t shown = 0;
+    for (auto row : users) {
+        if (row.get<&User::age>().value() == 89 && shown++ < 2) {
+            std::cout << "  row " << row.index() << " is " << row.get<&User::username>() << "\n";
+        }
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,345 @@
+#pragma once
+
+#include "meta.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// RECORD TABLE - struct of arrays, one column per field
+// ============================================================================
+//
+// RecordTable<T> keeps every member listed in T::fields in its own
+// contiguous, 64-byte aligned column, so a scan over one field reads only
+// that field's bytes:
+//
+//   meta::RecordTable<User> users;
+//   users.append(meta::parseEach<User>(dump));    // or push_back(user)
+//
+//   auto ages = users.column<&User::age>();        // std::span<BoundedInt<0, 150>>
+//   auto adults = std::count_if(ages.begin(), ages.end(),
+//                               [](auto a) { return a.value() >= 18; });
+//
+//   users[3].get<&User::active>() = false;         // row proxy, edits in place
+//   User u = users[3];                             // gathers the row into a T
+//
+// Members not listed in T::fields are not stored; rows read back with them
+// default-constructed, as PackedRecord::unpack() does.
+//
+
+namespace detail {
+
+// Growable array with an over-aligned buffer; unlike std::vector<bool> it
+// stores bool as bytes, so every column can be handed out as a span
+template<typename M>
+class Column {
+public:
+    static constexpr std::align_val_t kAlignment{std::max<size_t>(64, alignof(M))};
+
+    Column() = default;
+
+    // Delegating, so a throwing element copy still runs ~Column
+    Column(const Column& other) : Column() {
+        reserve(other.size_);
+        for (size_t i = 0; i < other.size_; i++) push_back(other.data_[i]);
+    }
+
+    Column(Column&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)) {}
+
+    Column& operator=(Column other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        return *this;
+    }
+
+    ~Column() {
+        clear();
+        release(data_);
+    }
+
+    template<typename V>
+    void push_back(V&& value) {
+        if (size_ == capacity_) reallocate(std::max<size_t>(16, capacity_ * 2));
+        std::construct_at(data_ + size_, std::forward<V>(value));
+        size_++;
+    }
+
+    void reserve(size_t count) {
+        if (count > capacity_) reallocate(count);
+    }
+
+    void pop_back() {
+        std::destroy_at(data_ + --size_);
+    }
+
+    void clear() {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+
+    M* data() { return data_; }
+    const M* data() const { return data_; }
+    size_t size() const { return size_; }
+    size_t capacity() const { return capacity_; }
+
+private:
+    M* data_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+
+    static void release(M* data) {
+        if (data) ::operator delete(data, kAlignment);
+    }
+
+    void reallocate(size_t capacity) {
+        M* fresh = static_cast<M*>(::operator new(capacity * sizeof(M), kAlignment));
+        std::uninitialized_move_n(data_, size_, fresh);
+        std::destroy_n(data_, size_);
+        release(data_);
+        data_ = fresh;
+        capacity_ = capacity;
+    }
+};
+
+}  // namespace detail
+
+template<HasFields T>
+class RecordTable {
+    using Fields = std::remove_cvref_t<decltype(T::fields)>;
+    static constexpr size_t fieldCount = field_count_v<T>;
+
+    template<size_t I>
+    using member_t = typename std::tuple_element_t<I, Fields>::type;
+
+    template<typename Indexes>
+    struct ColumnsOf;
+
+    template<size_t... I>
+    struct ColumnsOf<std::index_sequence<I...>> {
+        using type = std::tuple<detail::Column<member_t<I>>...>;
+    };
+
+    using Columns = typename ColumnsOf<std::make_index_sequence<fieldCount>>::type;
+
+    template<auto Member>
+    static consteval size_t indexOf() {
+        constexpr size_t I = fieldIndex<T, Member>();
+        static_assert(I < fieldCount, "Member is not listed in T::fields");
+        return I;
+    }
+
+    template<typename F>
+    static void forEachIndex(F&& f) {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (f(std::integral_constant<size_t, I>{}), ...);
+        }(std::make_index_sequence<fieldCount>{});
+    }
+
+public:
+    // ========================================
+    // Row proxies - a view of one index across all columns
+    // ========================================
+
+    template<bool Const>
+    class RowRef {
+        using Table = std::conditional_t<Const, const RecordTable, RecordTable>;
+
+    public:
+        RowRef(Table& table, size_t index) : table_(&table), index_(index) {}
+
+        size_t index() const { return index_; }
+
+        // Reference into the column (const for a ConstRow)
+        template<auto Member>
+        decltype(auto) get() const {
+            return table_->template column<Member>()[index_];
+        }
+
+        T load() const {
+            T obj{};
+            forEachIndex([&](auto I) {
+                obj.*std::get<I>(T::fields).memberPtr = std::get<I>(table_->columns_).data()[index_];
+            });
+            return obj;
+        }
+
+        operator T() const { return load(); }
+
+        // Overwrites every listed member of this row
+        void store(const T& obj) const
+            requires(!Const)
+        {
+            forEachIndex([&](auto I) {
+                std::get<I>(table_->columns_).data()[index_] = obj.*std::get<I>(T::fields).memberPtr;
+            });
+        }
+
+    private:
+        Table* table_;
+        size_t index_;
+    };
+
+    using Row = RowRef<false>;
+    using ConstRow = RowRef<true>;
+
+    template<bool Const>
+    class RowIterator {
+        using Table = std::conditional_t<Const, const RecordTable, RecordTable>;
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = RowRef<Const>;
+        using difference_type = std::ptrdiff_t;
+
+        RowIterator() = default;
+        RowIterator(Table& table, size_t index) : table_(&table), index_(index) {}
+
+        RowRef<Const> operator*() const { return RowRef<Const>(*table_, index_); }
+
+        RowIterator& operator++() {
+            index_++;
+            return *this;
+        }
+
+        RowIterator operator++(int) {
+            RowIterator before = *this;
+            index_++;
+            return before;
+        }
+
+        bool operator==(const RowIterator& other) const { return index_ == other.index_; }
+
+    private:
+        Table* table_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    // ========================================
+    // Size and rows
+    // ========================================
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void reserve(size_t count) {
+        forEachIndex([&](auto I) { std::get<I>(columns_).reserve(count); });
+    }
+
+    void clear() {
+        forEachIndex([&](auto I) { std::get<I>(columns_).clear(); });
+        size_ = 0;
+    }
+
+    // If a member's constructor throws, the table is left as it was (a
+    // moved-from obj may have lost the members already moved)
+    void push_back(const T& obj) {
+        appendRow([&](auto I) -> decltype(auto) { return obj.*std::get<I>(T::fields).memberPtr; });
+    }
+
+    void push_back(T&& obj) {
+        appendRow([&](auto I) -> decltype(auto) { return std::move(obj.*std::get<I>(T::fields).memberPtr); });
+    }
+
+    // Appends the records of a parseEach-style range of
+    // (optional<T>, ValidationResult); the rejected ones come back keyed
+    // by their position in the input, e.g. "[12].age"
+    template<std::ranges::input_range Parsed>
+    ValidationResult append(Parsed&& parsed) {
+        ValidationResult rejected;
+        size_t position = 0;
+        for (auto&& [obj, result] : parsed) {
+            if (obj) {
+                push_back(std::move(*obj));
+            } else {
+                rejected.mergeErrors("[" + std::to_string(position) + "]", result);
+            }
+            position++;
+        }
+        return rejected;
+    }
+
+    Row operator[](size_t index) { return Row(*this, index); }
+    ConstRow operator[](size_t index) const { return ConstRow(*this, index); }
+
+    RowIterator<false> begin() { return {*this, 0}; }
+    RowIterator<false> end() { return {*this, size_}; }
+    RowIterator<true> begin() const { return {*this, 0}; }
+    RowIterator<true> end() const { return {*this, size_}; }
+
+    // ========================================
+    // Columns
+    // ========================================
+
+    // One field for every row, contiguous and 64-byte aligned
+    template<auto Member>
+    std::span<member_t<indexOf<Member>()>> column() {
+        auto& c = std::get<indexOf<Member>()>(columns_);
+        return {c.data(), c.size()};
+    }
+
+    template<auto Member>
+    std::span<const member_t<indexOf<Member>()>> column() const {
+        const auto& c = std::get<indexOf<Member>()>(columns_);
+        return {c.data(), c.size()};
+    }
+
+    // Rows whose Member satisfies pred; reads only that column
+    template<auto Member, typename Pred>
+    std::vector<size_t> where(Pred pred) const {
+        auto values = column<Member>();
+        std::vector<size_t> rows;
+        for (size_t i = 0; i < values.size(); i++) {
+            if (pred(values[i])) rows.push_back(i);
+        }
+        return rows;
+    }
+
+private:
+    Columns columns_;
+    size_t size_ = 0;
+
+    // Every column makes room first, so only a member constructor can
+    // throw below; the columns already extended are then cut back, keeping
+    // all of them the same length
+    template<typename Member>
+    void appendRow(Member&& member) {
+        grow(size_ + 1);
+        size_t filled = 0;
+        try {
+            forEachIndex([&](auto I) {
+                std::get<I>(columns_).push_back(member(I));
+                filled++;
+            });
+        } catch (...) {
+            forEachIndex([&](auto I) {
+                if (I < filled) std::get<I>(columns_).pop_back();
+            });
+            throw;
+        }
+        size_++;
+    }
+
+    // Geometric, so pushing one row at a time stays amortised O(1)
+    void grow(size_t count) {
+        forEachIndex([&](auto I) {
+            auto& column = std::get<I>(columns_);
+            if (count > column.capacity()) column.reserve(std::max({count, column.capacity() * 2, size_t{16}}));
+        });
+    }
+};
+
+}  // namespace meta
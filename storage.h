@@ -0,0 +1,515 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// MAP STORAGE POLICIES
+// ============================================================================
+//
+// ConstrainedMap takes one of these as its last template argument:
+//
+//   OrderedStorage  std::map (default) - cheap inserts, ordered iteration
+//   PmrOrderedStorage  std::pmr::map - as above, allocating from a memory resource
+//   FlatStorage     sorted vector of pairs - binary search over contiguous memory,
+//                   out-of-order inserts batched into a small second run
+//   HashStorage     open addressing with 7-bit tags - O(1) lookups, insertion order
+//
+// Every backing container supports heterogeneous lookup, so a
+// std::string-keyed map can be queried with a std::string_view. freeze()
+// compacts the container once loading is finished; flush() applies any
+// batched inserts without compacting. Const members never modify the
+// container, so a map that is no longer written can be read from any
+// number of threads.
+//
+// Flat and hash storage keep the entries as pair<K, V> and iterate with a
+// proxy: *it is a pair<const K&, V&> by value, not a reference into the
+// map. Bind it with auto&& or const auto& (for (auto&& [key, value] : map));
+// for (auto& [key, value] : map) only compiles with OrderedStorage.
+//
+// Usage:
+//   meta::ConstrainedMap<std::string, int,
+//                        meta::NonEmptyStringConstraint,
+//                        meta::PositiveConstraint,
+//                        meta::HashStorage> limits;
+//
+
+namespace detail {
+
+// Hashes anything string-like through std::string_view, so std::string keys
+// and std::string_view / const char* probes land in the same bucket
+template<typename K>
+struct StorageHash {
+    template<typename Q>
+    size_t operator()(const Q& q) const {
+        if constexpr (std::is_convertible_v<const K&, std::string_view> &&
+                      std::is_convertible_v<const Q&, std::string_view>) {
+            return std::hash<std::string_view>{}(std::string_view(q));
+        } else {
+            return std::hash<K>{}(q);
+        }
+    }
+};
+
+// Iterator over a vector of pair<K, V> that hands the key out as const, as
+// std::flat_map does: *it is a pair<const K&, V&>, so values can be updated
+// in place but a key (and with it the sort order or hash index) cannot.
+// *it is a prvalue, so it binds to auto&& or const auto&, not auto&.
+template<typename K, typename V, bool Const>
+class EntryIterator {
+    using Entries = std::vector<std::pair<K, V>>;
+    using Base = std::conditional_t<Const, typename Entries::const_iterator, typename Entries::iterator>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<const K, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const K&, std::conditional_t<Const, const V&, V&>>;
+
+    struct pointer {
+        reference entry;
+        const reference* operator->() const { return &entry; }
+    };
+
+    EntryIterator() = default;
+    explicit EntryIterator(Base it) : it_(it) {}
+
+    // iterator -> const_iterator
+    template<bool C = Const>
+        requires C
+    EntryIterator(const EntryIterator<K, V, false>& other) : it_(other.base()) {}
+
+    reference operator*() const { return {it_->first, it_->second}; }
+    pointer operator->() const { return {**this}; }
+
+    EntryIterator& operator++() {
+        ++it_;
+        return *this;
+    }
+
+    EntryIterator operator++(int) {
+        EntryIterator before = *this;
+        ++it_;
+        return before;
+    }
+
+    EntryIterator& operator--() {
+        --it_;
+        return *this;
+    }
+
+    EntryIterator operator--(int) {
+        EntryIterator before = *this;
+        --it_;
+        return before;
+    }
+
+    bool operator==(const EntryIterator& other) const { return it_ == other.it_; }
+
+    Base base() const { return it_; }
+
+private:
+    Base it_{};
+};
+
+// Same interface over two sorted runs of pair<K, V> with no key in common,
+// merged as it goes, so FlatMap iterates in key order without having to
+// sort first
+template<typename K, typename V, bool Const>
+class MergedEntryIterator {
+    using Entries = std::conditional_t<Const, const std::vector<std::pair<K, V>>, std::vector<std::pair<K, V>>>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<const K, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const K&, std::conditional_t<Const, const V&, V&>>;
+
+    struct pointer {
+        reference entry;
+        const reference* operator->() const { return &entry; }
+    };
+
+    MergedEntryIterator() = default;
+    MergedEntryIterator(Entries& first, Entries& second, size_t i, size_t j)
+        : first_(&first), second_(&second), i_(i), j_(j) {}
+
+    // iterator -> const_iterator
+    template<bool C = Const>
+        requires C
+    MergedEntryIterator(const MergedEntryIterator<K, V, false>& other)
+        : first_(other.first_), second_(other.second_), i_(other.i_), j_(other.j_) {}
+
+    reference operator*() const {
+        auto& entry = fromFirst() ? (*first_)[i_] : (*second_)[j_];
+        return {entry.first, entry.second};
+    }
+
+    pointer operator->() const { return {**this}; }
+
+    MergedEntryIterator& operator++() {
+        if (fromFirst()) {
+            i_++;
+        } else {
+            j_++;
+        }
+        return *this;
+    }
+
+    MergedEntryIterator operator++(int) {
+        MergedEntryIterator before = *this;
+        ++*this;
+        return before;
+    }
+
+    // Steps back to the larger of the two entries just behind
+    MergedEntryIterator& operator--() {
+        if (j_ == 0 || (i_ > 0 && (*second_)[j_ - 1].first < (*first_)[i_ - 1].first)) {
+            i_--;
+        } else {
+            j_--;
+        }
+        return *this;
+    }
+
+    MergedEntryIterator operator--(int) {
+        MergedEntryIterator before = *this;
+        --*this;
+        return before;
+    }
+
+    bool operator==(const MergedEntryIterator& other) const { return i_ == other.i_ && j_ == other.j_; }
+
+private:
+    template<typename, typename, bool>
+    friend class MergedEntryIterator;
+
+    Entries* first_ = nullptr;
+    Entries* second_ = nullptr;
+    size_t i_ = 0;
+    size_t j_ = 0;
+
+    bool fromFirst() const {
+        return j_ == second_->size() || (i_ < first_->size() && (*first_)[i_].first < (*second_)[j_].first);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// std::map with a transparent comparator
+// ----------------------------------------------------------------------------
+
+template<typename K, typename V, typename Map = std::map<K, V, std::less<>>>
+class OrderedMap {
+public:
+    using container_type = Map;
+    using allocator_type = typename Map::allocator_type;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    OrderedMap() = default;
+    explicit OrderedMap(const allocator_type& alloc) : map_(alloc) {}
+
+    V& operator[](const K& key) { return map_[key]; }
+
+    template<typename KK, typename VV>
+    void insert_or_assign(KK&& key, VV&& value) {
+        map_.insert_or_assign(std::forward<KK>(key), std::forward<VV>(value));
+    }
+
+    template<typename Q>
+    const V* find(const Q& key) const {
+        auto it = map_.find(key);
+        return it != map_.end() ? &it->second : nullptr;
+    }
+
+    void flush() {}
+    void freeze() {}
+
+    size_t size() const { return map_.size(); }
+    bool empty() const { return map_.empty(); }
+
+    iterator begin() { return map_.begin(); }
+    iterator end() { return map_.end(); }
+    const_iterator begin() const { return map_.begin(); }
+    const_iterator end() const { return map_.end(); }
+
+private:
+    container_type map_;
+};
+
+// ----------------------------------------------------------------------------
+// Sorted vector of pairs
+// ----------------------------------------------------------------------------
+//
+// Entries live in two sorted runs with no key in common: the main run, and
+// a short pending run of the keys that arrived out of order. A new key
+// larger than every key in the main run is appended to it; any other key is
+// inserted into the pending run, which is merged into the main run once it
+// outgrows about 2 sqrt(n) entries. Loading n entries in any order therefore
+// costs O(n sqrt n) element moves rather than O(n^2), and a lookup is two
+// binary searches whatever order the keys came in. insert_range sorts a
+// whole batch once and merges it in, which is the cheaper way to bulk-load.
+// flush() merges the pending run early; iteration merges the two runs as it
+// goes.
+
+template<typename K, typename V>
+class FlatMap {
+public:
+    using container_type = std::vector<std::pair<K, V>>;
+    using allocator_type = void;  // not allocator-aware
+    using iterator = MergedEntryIterator<K, V, false>;
+    using const_iterator = MergedEntryIterator<K, V, true>;
+
+    V& operator[](const K& key) {
+        if (V* value = findIn(entries_, key)) return *value;
+        if (V* value = findIn(pending_, key)) return *value;
+        return insertNew(key, V{});
+    }
+
+    template<typename KK, typename VV>
+    void insert_or_assign(KK&& key, VV&& value) {
+        if (V* existing = findIn(entries_, key)) {
+            *existing = std::forward<VV>(value);
+        } else if (V* pending = findIn(pending_, key)) {
+            *pending = std::forward<VV>(value);
+        } else {
+            insertNew(std::forward<KK>(key), std::forward<VV>(value));
+        }
+    }
+
+    // O(m log m) for the batch plus one O(n + m) merge; on equal keys the
+    // later entry wins
+    void insert_range(std::span<const std::pair<K, V>> batch) {
+        flush();
+        container_type added(batch.begin(), batch.end());
+        auto byKey = [](const auto& a, const auto& b) { return a.first < b.first; };
+        std::stable_sort(added.begin(), added.end(), byKey);
+
+        // Last of each run of equal keys; keys already present are assigned in place
+        auto out = added.begin();
+        for (auto it = added.begin(); it != added.end();) {
+            auto last = it;
+            while (last + 1 != added.end() && !byKey(*last, *(last + 1))) ++last;
+            if (V* existing = findIn(entries_, last->first)) {
+                *existing = std::move(last->second);
+            } else {
+                if (out != last) *out = std::move(*last);
+                ++out;
+            }
+            it = last + 1;
+        }
+        added.erase(out, added.end());
+        pending_ = std::move(added);
+        flush();
+    }
+
+    template<typename Q>
+    const V* find(const Q& key) const {
+        if (const V* value = findIn(entries_, key)) return value;
+        return findIn(pending_, key);
+    }
+
+    // Merges the pending run into the main one
+    void flush() {
+        if (pending_.empty()) return;
+        auto middle = static_cast<std::ptrdiff_t>(entries_.size());
+        entries_.insert(entries_.end(), std::make_move_iterator(pending_.begin()),
+                        std::make_move_iterator(pending_.end()));
+        pending_.clear();
+        std::inplace_merge(entries_.begin(), entries_.begin() + middle, entries_.end(),
+                           [](const auto& a, const auto& b) { return a.first < b.first; });
+    }
+
+    void freeze() {
+        flush();
+        entries_.shrink_to_fit();
+        pending_.shrink_to_fit();
+    }
+
+    size_t size() const { return entries_.size() + pending_.size(); }
+    bool empty() const { return entries_.empty() && pending_.empty(); }
+
+    iterator begin() { return iterator(entries_, pending_, 0, 0); }
+    iterator end() { return iterator(entries_, pending_, entries_.size(), pending_.size()); }
+    const_iterator begin() const { return const_iterator(entries_, pending_, 0, 0); }
+    const_iterator end() const { return const_iterator(entries_, pending_, entries_.size(), pending_.size()); }
+
+private:
+    static constexpr size_t kMinPending = 32;
+
+    container_type entries_;  // sorted, unique
+    container_type pending_;  // sorted, unique, no key also in entries_
+
+    template<typename KK, typename VV>
+    V& insertNew(KK&& key, VV&& value) {
+        if (entries_.empty() || entries_.back().first < key) {
+            return entries_.emplace_back(std::forward<KK>(key), std::forward<VV>(value)).second;
+        }
+        // ~2 sqrt(n): balances shifting within the pending run against merging it
+        size_t limit = std::max(kMinPending, size_t{2} << (std::bit_width(entries_.size()) / 2));
+        if (pending_.size() >= limit) flush();
+        auto it = lowerBound(pending_.begin(), pending_.end(), key);
+        return pending_.emplace(it, std::forward<KK>(key), std::forward<VV>(value))->second;
+    }
+
+    // Pointer to the value for key in one run, const if the run is
+    template<typename Entries, typename Q>
+    static auto findIn(Entries& entries, const Q& key) -> decltype(&entries.front().second) {
+        auto it = lowerBound(entries.begin(), entries.end(), key);
+        return (it != entries.end() && it->first == key) ? &it->second : nullptr;
+    }
+
+    template<typename It, typename Q>
+    static It lowerBound(It first, It last, const Q& key) {
+        return std::lower_bound(first, last, key,
+            [](const auto& entry, const Q& k) { return entry.first < k; });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Open addressing (Swiss-table style)
+// ----------------------------------------------------------------------------
+//
+// Entries live densely in insertion order; the probe table holds entry
+// indexes plus a 7-bit tag from the hash, so most mismatches are rejected
+// by a one-byte compare without touching the entry itself.
+
+template<typename K, typename V>
+class HashMap {
+public:
+    using container_type = std::vector<std::pair<K, V>>;
+    using allocator_type = void;  // not allocator-aware
+    using iterator = EntryIterator<K, V, false>;
+    using const_iterator = EntryIterator<K, V, true>;
+
+    V& operator[](const K& key) {
+        size_t slot = probe(key);
+        if (slots_.empty() || slots_[slot] == kEmpty) {
+            return insertNew(key, V{});
+        }
+        return entries_[slots_[slot] - 1].second;
+    }
+
+    template<typename KK, typename VV>
+    void insert_or_assign(KK&& key, VV&& value) {
+        size_t slot = probe(key);
+        if (slots_.empty() || slots_[slot] == kEmpty) {
+            insertNew(std::forward<KK>(key), std::forward<VV>(value));
+        } else {
+            entries_[slots_[slot] - 1].second = std::forward<VV>(value);
+        }
+    }
+
+    template<typename Q>
+    const V* find(const Q& key) const {
+        if (slots_.empty()) return nullptr;
+        uint32_t idx = slots_[probe(key)];
+        return idx != kEmpty ? &entries_[idx - 1].second : nullptr;
+    }
+
+    void flush() {}
+
+    // Rebuild at a load factor of at most 1/2 and drop spare entry capacity
+    void freeze() {
+        entries_.shrink_to_fit();
+        if (!entries_.empty()) {
+            rehash(std::bit_ceil(entries_.size() * 2));
+        }
+    }
+
+    size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+
+    iterator begin() { return iterator(entries_.begin()); }
+    iterator end() { return iterator(entries_.end()); }
+    const_iterator begin() const { return const_iterator(entries_.begin()); }
+    const_iterator end() const { return const_iterator(entries_.end()); }
+
+private:
+    static constexpr uint32_t kEmpty = 0;
+    static constexpr size_t kMinSlots = 16;
+
+    container_type entries_;
+    std::vector<uint32_t> slots_;  // entry index + 1, kEmpty if unused
+    std::vector<uint8_t> tags_;    // top 7 bits of the hash, per slot
+
+    static uint8_t tagOf(size_t h) { return static_cast<uint8_t>(h >> (sizeof(size_t) * 8 - 7)); }
+
+    // Slot holding key, or the empty slot where it would go
+    template<typename Q>
+    size_t probe(const Q& key) const {
+        if (slots_.empty()) return 0;
+        size_t h = StorageHash<K>{}(key);
+        uint8_t tag = tagOf(h);
+        size_t mask = slots_.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            uint32_t idx = slots_[i];
+            if (idx == kEmpty) return i;
+            if (tags_[i] == tag && entries_[idx - 1].first == key) return i;
+        }
+    }
+
+    template<typename KK, typename VV>
+    V& insertNew(KK&& key, VV&& value) {
+        if ((entries_.size() + 1) * 8 > slots_.size() * 7) {
+            rehash(std::max(kMinSlots, slots_.size() * 2));
+        }
+        entries_.emplace_back(std::forward<KK>(key), std::forward<VV>(value));
+        place(entries_.size() - 1);
+        return entries_.back().second;
+    }
+
+    void place(size_t entryIndex) {
+        size_t h = StorageHash<K>{}(entries_[entryIndex].first);
+        size_t mask = slots_.size() - 1;
+        size_t i = h & mask;
+        while (slots_[i] != kEmpty) i = (i + 1) & mask;
+        slots_[i] = static_cast<uint32_t>(entryIndex + 1);
+        tags_[i] = tagOf(h);
+    }
+
+    void rehash(size_t slotCount) {
+        slots_.assign(slotCount, kEmpty);
+        tags_.assign(slotCount, 0);
+        for (size_t i = 0; i < entries_.size(); i++) {
+            place(i);
+        }
+    }
+};
+
+}  // namespace detail
+
+struct OrderedStorage {
+    template<typename K, typename V>
+    using container = detail::OrderedMap<K, V>;
+};
+
+struct PmrOrderedStorage {
+    template<typename K, typename V>
+    using container = detail::OrderedMap<K, V, std::pmr::map<K, V, std::less<>>>;
+};
+
+struct FlatStorage {
+    template<typename K, typename V>
+    using container = detail::FlatMap<K, V>;
+};
+
+struct HashStorage {
+    template<typename K, typename V>
+    using container = detail::HashMap<K, V>;
+};
+
+}  // namespace meta
@@ -0,0 +1,98 @@
+#include "meta.h"
+#include "bounded.h"
+#include "stream.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+// ============================================================================
+// ELEMENT TYPE
+// ============================================================================
+
+struct User {
+    std::string username;
+    meta::BoundedInt<0, 150> age;
+    bool active = true;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&User::username>("username", "Login name", meta::RequiredField),
+        meta::Field<&User::age>("age", "Age in years", meta::RequiredField),
+        meta::Field<&User::active>("active", "Account enabled", meta::OptionalField)
+    };
+};
+
+// A dump that is produced as it is read, so the whole file never exists in
+// memory; stands in for a multi-gigabyte file or socket
+class EventDump : public std::streambuf {
+public:
+    explicit EventDump(size_t count) : count_(count) {}
+
+protected:
+    int_type underflow() override {
+        if (next_ == count_) return traits_type::eof();
+        line_ = "- username: user" + std::to_string(next_) + "\n"
+                "  age: " + std::to_string(next_ % 160) + "\n";
+        next_++;
+        setg(line_.data(), line_.data(), line_.data() + line_.size());
+        return traits_type::to_int_type(line_[0]);
+    }
+
+private:
+    size_t count_;
+    size_t next_ = 0;
+    std::string line_;
+};
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== Streaming Parse ===\n\n";
+
+    // ========================================
+    // 200k elements, one at a time
+    // ========================================
+    std::cout << "--- Block Sequence ---\n";
+
+    EventDump dump(200000);
+    std::istream in(&dump);
+
+    size_t ok = 0;
+    size_t rejected = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (auto&& [user, result] : meta::parseEach<User>(in)) {
+        if (user) {
+            ok++;
+        } else if (rejected++ < 3) {
+            for (const auto& [field, msg] : result.errors) {
+                std::cout << "  ✗ " << field << ": " << msg << "\n";
+            }
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "✓ " << ok << " users, " << rejected << " rejected, " << elapsed.count() << " ms\n";
+
+    // ========================================
+    // JSON arrays work the same way
+    // ========================================
+    std::cout << "\n--- JSON Array ---\n";
+
+    std::istringstream json(R"([
+        {"username": "alice", "age": 30},
+        {"username": "bob, jr.", "age": 41, "active": false},
+        {"username": "carol"}
+    ])");
+
+    for (auto&& [user, result] : meta::parseEach<User>(json)) {
+        if (user) {
+            std::cout << "✓ " << user->username << " (" << user->age.value() << ")\n";
+        } else {
+            std::cout << "✗ " << result.errors.front().first << ": " << result.errors.front().second << "\n";
+        }
+    }
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
@@ -0,0 +1,296 @@
+#pragma once
+
+#include "meta.h"
+#include "generator.h"
+#include <cstddef>
+#include <istream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace meta {
+
+// ============================================================================
+// STREAMING - one element of a huge top-level sequence at a time
+// ============================================================================
+//
+//   std::ifstream dump("events.yaml");
+//   for (auto&& [event, result] : meta::parseEach<Event>(dump)) {
+//       if (event) process(*event);
+//   }
+//
+// The input is read in fixed-size chunks and split into elements as text,
+// without a YAML::Node for the whole document: only the element being
+// decoded (plus at most one chunk) is in memory, however long the file.
+// Each element is then loaded and run through fromYamlWithValidation<T>.
+// Both block sequences ("- name: a" items at the sequence's indentation)
+// and flow sequences / JSON arrays ("[{...}, {...}]") are accepted.
+//
+// A damaged element yields its own error and the stream carries on with
+// the next one; input that is not a sequence at all, or a flow sequence
+// cut off before its ']', yields a final error.
+//
+
+namespace detail {
+
+class SequenceReader {
+public:
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    explicit SequenceReader(std::istream& in, size_t chunkSize = kChunkSize)
+        : in_(in), chunkSize_(chunkSize) {}
+
+    // Text of the next element, valid until the following call; nullopt at
+    // the end of the sequence
+    std::optional<std::string_view> next() {
+        if (done_) return std::nullopt;
+        discardConsumed();
+        if (style_ == Style::Unknown && !detectStyle()) return std::nullopt;
+        return style_ == Style::Block ? nextBlock() : nextFlow();
+    }
+
+    // Why the sequence ended early, empty if it did not
+    const std::string& error() const { return error_; }
+
+private:
+    enum class Style { Unknown, Block, Flow };
+
+    std::istream& in_;
+    size_t chunkSize_;
+    std::string buffer_;
+    size_t base_ = 0;      // start of the text not handed out yet
+    size_t consumed_ = 0;  // end of the last element handed out
+    bool eof_ = false;
+    bool done_ = false;
+    std::string error_;
+    Style style_ = Style::Unknown;
+
+    size_t indent_ = 0;  // column of the block sequence's '-'
+
+    // Flow scanning state, kept across refills
+    size_t scan_ = 0;
+    int depth_ = 0;
+    char quote_ = 0;
+
+    bool fill() {
+        if (eof_) return false;
+        size_t old = buffer_.size();
+        buffer_.resize(old + chunkSize_);
+        in_.read(buffer_.data() + old, static_cast<std::streamsize>(chunkSize_));
+        size_t got = static_cast<size_t>(in_.gcount());
+        buffer_.resize(old + got);
+        if (got < chunkSize_) eof_ = true;
+        return got > 0;
+    }
+
+    // Drops handed-out text once it outweighs what is left, so each byte
+    // is moved a bounded number of times
+    void discardConsumed() {
+        base_ = consumed_;
+        if (base_ >= chunkSize_ && base_ * 2 >= buffer_.size()) {
+            buffer_.erase(0, base_);
+            scan_ = scan_ > base_ ? scan_ - base_ : 0;
+            consumed_ = base_ = 0;
+        }
+    }
+
+    void fail(std::string message) {
+        error_ = std::move(message);
+        done_ = true;
+    }
+
+    // End of the line starting at pos (exclusive of '\n'); npos if more
+    // input is needed to see it
+    size_t lineEnd(size_t pos) {
+        for (;;) {
+            size_t newline = buffer_.find('\n', pos);
+            if (newline != std::string::npos) return newline;
+            if (!fill()) return buffer_.size() > pos ? buffer_.size() : std::string::npos;
+        }
+    }
+
+    static bool isBlank(std::string_view line) {
+        size_t first = line.find_first_not_of(" \t\r");
+        return first == std::string_view::npos || line[first] == '#';
+    }
+
+    static bool isDash(std::string_view line, size_t at) {
+        return at < line.size() && line[at] == '-' &&
+               (at + 1 == line.size() || line[at + 1] == ' ' || line[at + 1] == '\r' || line[at + 1] == '\t');
+    }
+
+    // Skips comments, directives and '---' up to the first element
+    bool detectStyle() {
+        size_t pos = base_;
+        for (;;) {
+            size_t end = lineEnd(pos);
+            if (end == std::string::npos) {
+                done_ = true;  // empty document: no elements
+                return false;
+            }
+            std::string_view line(buffer_.data() + pos, end - pos);
+            bool directive = line.starts_with("%") || line.starts_with("---");
+            if (!isBlank(line) && !directive) {
+                size_t first = line.find_first_not_of(" \t");
+                if (isDash(line, first)) {
+                    style_ = Style::Block;
+                    indent_ = first;
+                    consumed_ = pos;
+                } else if (line[first] == '[') {
+                    style_ = Style::Flow;
+                    consumed_ = pos + first + 1;
+                    scan_ = consumed_;
+                    depth_ = 1;
+                } else {
+                    fail("Expected a sequence at the top level");
+                    return false;
+                }
+                discardConsumed();
+                return true;
+            }
+            pos = end + 1;
+        }
+    }
+
+    std::optional<std::string_view> nextBlock() {
+        // base_ is at an element's '-' line (or at the end)
+        size_t end = lineEnd(base_);
+        if (end == std::string::npos) {
+            done_ = true;
+            return std::nullopt;
+        }
+        std::string_view first(buffer_.data() + base_, end - base_);
+        if (!isDash(first, indent_) || first.find_first_not_of(' ') != indent_) {
+            done_ = true;  // '...', '---' or a dedent: the sequence is over
+            return std::nullopt;
+        }
+
+        size_t pos = end + 1;
+        for (;;) {
+            size_t lineStop = pos < buffer_.size() || fill() ? lineEnd(pos) : std::string::npos;
+            if (lineStop == std::string::npos) {
+                pos = buffer_.size();
+                done_ = true;
+                break;
+            }
+            std::string_view line(buffer_.data() + pos, lineStop - pos);
+            if (!isBlank(line)) {
+                size_t column = line.find_first_not_of(' ');
+                if (column <= indent_) break;  // next element or end of sequence
+            }
+            pos = lineStop + 1;
+        }
+
+        // The '-' becomes indentation so the element parses as a mapping
+        buffer_[base_ + indent_] = ' ';
+        consumed_ = std::min(pos, buffer_.size());
+        return std::string_view(buffer_.data() + base_, consumed_ - base_);
+    }
+
+    std::optional<std::string_view> nextFlow() {
+        for (;;) {
+            // First element character, skipping separators
+            while (scan_ < buffer_.size() || fill()) {
+                char c = buffer_[scan_];
+                if (isSpace(c) || c == ',') {
+                    scan_++;
+                } else {
+                    break;
+                }
+            }
+            if (scan_ >= buffer_.size()) {
+                fail("Sequence is not closed with ']'");
+                return std::nullopt;
+            }
+            if (buffer_[scan_] == ']') {
+                done_ = true;
+                return std::nullopt;
+            }
+
+            size_t begin = scan_;
+            char previous = ',';
+            while (scan_ < buffer_.size() || fill()) {
+                char c = buffer_[scan_];
+                if (quote_) {
+                    if (c == '\\' && quote_ == '"') {
+                        if (scan_ + 1 >= buffer_.size() && !fill()) break;
+                        scan_++;
+                    } else if (c == quote_) {
+                        quote_ = 0;
+                    }
+                } else if ((c == '"' || c == '\'') && isTokenStart(previous)) {
+                    quote_ = c;
+                } else if (c == '#' && scan_ > begin && isSpace(buffer_[scan_ - 1])) {
+                    size_t newline = buffer_.find('\n', scan_);
+                    while (newline == std::string::npos && fill()) newline = buffer_.find('\n', scan_);
+                    scan_ = newline == std::string::npos ? buffer_.size() : newline;
+                    continue;
+                } else if (c == '[' || c == '{') {
+                    depth_++;
+                } else if (c == ']' || c == '}') {
+                    if (--depth_ == 0) break;  // end of the outer sequence
+                } else if (c == ',' && depth_ == 1) {
+                    break;
+                }
+                if (c != ' ' && c != '\t') previous = c;  // '\n' counts: a quote may start a line
+                scan_++;
+            }
+            if (scan_ >= buffer_.size()) {
+                fail("Sequence is not closed with ']'");
+                return std::nullopt;
+            }
+            if (depth_ == 0) depth_ = 1;  // leave the ']' for the next call
+
+            consumed_ = scan_;
+            std::string_view element(buffer_.data() + begin, scan_ - begin);
+            while (!element.empty() && isSpace(element.back())) element.remove_suffix(1);
+            if (!element.empty()) return element;
+        }
+    }
+
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    static bool isTokenStart(char previous) {
+        return previous == ',' || previous == '[' || previous == '{' || previous == ':' || previous == '\n';
+    }
+};
+
+template<HasFields T, ParseMode Mode>
+std::pair<std::optional<T>, ValidationResult> parseElement(std::string_view text) {
+    try {
+        ViewStreamBuf buffer(text);
+        std::istream in(&buffer);
+        return fromYamlWithValidation<T, Mode>(YAML::Load(in));
+    } catch (const std::exception& e) {
+        ValidationResult result;
+        result.addError("", std::string("Parse error: ") + e.what());
+        return {std::nullopt, result};
+    }
+}
+
+}  // namespace detail
+
+template<HasFields T, ParseMode Mode = ParseMode::CollectAll>
+Generator<std::pair<std::optional<T>, ValidationResult>> parseEach(std::istream& in) {
+    detail::SequenceReader reader(in);
+    while (auto text = reader.next()) {
+        co_yield detail::parseElement<T, Mode>(*text);
+    }
+    if (!reader.error().empty()) {
+        ValidationResult result;
+        result.addError("", reader.error());
+        co_yield std::pair<std::optional<T>, ValidationResult>{std::nullopt, std::move(result)};
+    }
+}
+
+template<HasFields T, ParseMode Mode = ParseMode::CollectAll>
+Generator<std::pair<std::optional<T>, ValidationResult>> parseEach(std::string_view text) {
+    ViewStreamBuf buffer(text);
+    std::istream in(&buffer);
+    for (auto& element : parseEach<T, Mode>(in)) {
+        co_yield std::move(element);
+    }
+}
+
+}  // namespace meta
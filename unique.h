@@ -0,0 +1,238 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace meta {
+
+// ============================================================================
+// UNIQUENESS - "no duplicates" for list-like fields and containers
+// ============================================================================
+//
+// Duplicates policy for ConstrainedVector / WhitelistVector / BoundedVector:
+//
+//   AllowDuplicates   (default) any element may repeat
+//   UniqueElements    a repeated element is rejected
+//
+// and UniqueConstraint for Field, which covers plain list members:
+//
+//   meta::Field<&AppConfig::features, meta::UniqueConstraint>("features", ...)
+//
+// Whole-list checks are O(n): one pass with a transient hash set keyed on
+// the element (string-like elements hash as string_view, so nothing is
+// copied). Very short lists are compared pairwise instead. Containers that
+// grow one element at a time keep a UniqueIndex of positions instead, so
+// each insert is checked in O(1).
+//
+
+struct AllowDuplicates {};
+struct UniqueElements {};
+
+template<typename Policy>
+inline constexpr bool is_unique_v = std::is_same_v<Policy, UniqueElements>;
+
+namespace detail {
+
+// What two elements are compared by: the text of string-like values, the
+// wrapped value of BoundedString / BoundedInt, the element otherwise
+template<typename T>
+decltype(auto) uniqueKey(const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        return std::string_view(value);
+    } else if constexpr (requires { value.val; }) {
+        return uniqueKey(value.val);
+    } else if constexpr (requires { { value.value() } -> std::integral; }) {
+        return value.value();
+    } else {
+        return (value);
+    }
+}
+
+template<typename T>
+using unique_key_t = std::remove_cvref_t<decltype(uniqueKey(std::declval<const T&>()))>;
+
+// Below this many elements a pairwise scan beats building a hash set
+inline constexpr size_t kPairwiseDuplicateScan = 8;
+
+// Index into `added` of the first element equal to one in `existing` or to
+// an earlier element of `added`, if any
+template<std::ranges::forward_range Existing, std::ranges::forward_range Added>
+std::optional<size_t> findDuplicate(const Existing& existing, const Added& added) {
+    using Key = unique_key_t<std::ranges::range_value_t<Added>>;
+    size_t n = static_cast<size_t>(std::ranges::distance(existing) + std::ranges::distance(added));
+
+    if constexpr (requires(const Key& k) { std::hash<Key>{}(k); }) {
+        if (n > kPairwiseDuplicateScan) {
+            std::unordered_set<Key> seen;
+            seen.reserve(n);
+            for (const auto& value : existing) seen.insert(uniqueKey(value));
+            size_t index = 0;
+            for (const auto& value : added) {
+                if (!seen.insert(uniqueKey(value)).second) return index;
+                index++;
+            }
+            return std::nullopt;
+        }
+    }
+
+    size_t index = 0;
+    for (auto it = std::ranges::begin(added); it != std::ranges::end(added); ++it, ++index) {
+        for (const auto& value : existing) {
+            if (uniqueKey(value) == uniqueKey(*it)) return index;
+        }
+        for (auto prev = std::ranges::begin(added); prev != it; ++prev) {
+            if (uniqueKey(*prev) == uniqueKey(*it)) return index;
+        }
+    }
+    return std::nullopt;
+}
+
+// Index of the first element equal to an earlier one, if any
+template<std::ranges::forward_range Range>
+std::optional<size_t> findDuplicate(const Range& values) {
+    return findDuplicate(std::ranges::empty_view<std::ranges::range_value_t<Range>>{}, values);
+}
+
+// Open-addressed set of positions into an append-only random-access
+// container, hashed by each element's uniqueKey. It stores positions rather
+// than keys, so it stays valid when the container reallocates, and lets
+// UniqueElements containers reject a repeat in O(1) instead of scanning.
+// Elements edited in place through a mutable reference are not re-indexed.
+template<typename T, typename Alloc = std::allocator<size_t>>
+class UniqueIndex {
+public:
+    using allocator_type = Alloc;
+
+    UniqueIndex() = default;
+    explicit UniqueIndex(const Alloc& alloc) : slots_(alloc) {}
+
+    static constexpr bool supported = requires(const unique_key_t<T>& k) { std::hash<unique_key_t<T>>{}(k); };
+
+    template<typename Container, typename Q>
+    bool contains(const Container& data, const Q& value) const {
+        if (slots_.empty()) return false;
+        const auto& key = uniqueKey(value);
+        size_t mask = slots_.size() - 1;
+        for (size_t i = slotOf(key, mask);; i = (i + 1) & mask) {
+            size_t position = slots_[i];
+            if (position == kEmpty) return false;
+            if (uniqueKey(data[position - 1]) == key) return true;
+        }
+    }
+
+    // Records data[position], which must be the element just appended.
+    // Does not throw if reserve() already made room for it.
+    template<typename Container>
+    void add(const Container& data, size_t position) {
+        if ((count_ + 1) * 2 > slots_.size()) rehash(data, std::max<size_t>(16, slots_.size() * 2));
+        place(data, position);
+        count_++;
+    }
+
+    template<typename Container>
+    void reserve(const Container& data, size_t n) {
+        if (n * 2 > slots_.size()) rehash(data, std::bit_ceil(n * 2));
+    }
+
+private:
+    static constexpr size_t kEmpty = 0;
+
+    std::vector<size_t, Alloc> slots_;  // position + 1, kEmpty if unused
+    size_t count_ = 0;
+
+    template<typename Key>
+    static size_t slotOf(const Key& key, size_t mask) {
+        uint64_t h = std::hash<unique_key_t<T>>{}(key) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(h ^ (h >> 32)) & mask;
+    }
+
+    template<typename Container>
+    void place(const Container& data, size_t position) {
+        size_t mask = slots_.size() - 1;
+        size_t i = slotOf(uniqueKey(data[position]), mask);
+        while (slots_[i] != kEmpty) i = (i + 1) & mask;
+        slots_[i] = position + 1;
+    }
+
+    template<typename Container>
+    void rehash(const Container& data, size_t slotCount) {
+        slots_.assign(slotCount, kEmpty);
+        for (size_t position = 0; position < count_; position++) place(data, position);
+    }
+};
+
+template<typename Container>
+struct index_allocator {
+    using type = std::allocator<size_t>;
+};
+
+template<typename Container>
+    requires(!std::is_void_v<typename Container::allocator_type>)
+struct index_allocator<Container> {
+    using type = typename std::allocator_traits<typename Container::allocator_type>::template rebind_alloc<size_t>;
+};
+
+// The index a Duplicates-checking container keeps next to its elements, or
+// std::monostate when it needs none (duplicates allowed, the container has
+// its own contains(), or the key cannot be hashed)
+template<typename T, typename Container, typename Duplicates>
+using unique_index_for_t = std::conditional_t<
+    is_unique_v<Duplicates> && UniqueIndex<T>::supported &&
+        !requires(const Container& c, const T& v) { c.contains(v); },
+    UniqueIndex<T, typename index_allocator<Container>::type>,
+    std::monostate>;
+
+// Built on the container's allocator, so a pmr container's index lives in
+// the same arena
+template<typename Index, typename Container>
+Index makeUniqueIndex(const Container& data) {
+    if constexpr (requires { typename Index::allocator_type; data.get_allocator(); }) {
+        return Index(typename Index::allocator_type(data.get_allocator()));
+    } else {
+        return Index();
+    }
+}
+
+template<typename T>
+std::string describeElement(const T& value) {
+    const auto& key = uniqueKey(value);
+    using Key = std::remove_cvref_t<decltype(key)>;
+    if constexpr (std::is_same_v<Key, std::string_view>) {
+        return "'" + std::string(key) + "'";
+    } else if constexpr (std::is_arithmetic_v<Key>) {
+        return std::to_string(key);
+    } else {
+        return "element";
+    }
+}
+
+}  // namespace detail
+
+struct UniqueConstraint {
+    template<std::ranges::forward_range Range>
+    static bool validate(const Range& values) {
+        return !detail::findDuplicate(values).has_value();
+    }
+
+    template<std::ranges::forward_range Range>
+    static std::string error(const Range& values) {
+        auto index = detail::findDuplicate(values);
+        if (!index) return "Elements are unique";
+        auto it = std::ranges::next(std::ranges::begin(values), static_cast<std::ptrdiff_t>(*index));
+        return "Duplicate " + detail::describeElement(*it) + " at index " + std::to_string(*index);
+    }
+};
+
+}  // namespace meta
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+
+namespace meta {
+
+namespace detail {
+
+// Uses Constraint::validate_batch when the constraint provides one, so a
+// whole range can be checked without a branch per element
+template<typename Constraint, typename T>
+bool validateRange(std::span<const T> values) {
+    if constexpr (requires { { Constraint::validate_batch(values) } -> std::convertible_to<bool>; }) {
+        return Constraint::validate_batch(values);
+    } else {
+        for (const auto& value : values) {
+            if (!Constraint::validate(value)) return false;
+        }
+        return true;
+    }
+}
+
+}  // namespace detail
+
+}  // namespace meta
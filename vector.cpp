@@ -35,6 +35,17 @@ struct AppConfig {
     };
 };
 
+// Each environment at most once; features must not repeat either
+struct DeployConfig {
+    meta::WhitelistSet<std::string, allowed_envs> targets;
+    std::vector<std::string> features;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&DeployConfig::targets>("targets", "Deploy targets", meta::RequiredField),
+        meta::Field<&DeployConfig::features, meta::UniqueConstraint>("features", "Feature flags", meta::OptionalField)
+    };
+};
+
 int main() {
     std::cout << "=== WhitelistVector with fromYaml ===\n\n";
 
@@ -121,6 +132,35 @@ int main() {
         }
     }
 
+    // ========================================
+    // Example 4: Duplicates rejected
+    // ========================================
+    std::cout << "\n--- Example 4: Unique Elements ---\n";
+
+    YAML::Node yaml4 = YAML::Load(R"(
+        targets: [prod, dev]
+        features: [search, billing]
+    )");
+
+    auto [deploy, result4] = meta::fromYamlWithValidation<DeployConfig>(yaml4);
+    if (deploy) {
+        std::cout << "✓ Targets (sorted): " << meta::dispatchToString(deploy->targets)
+                  << ", prod included: " << (deploy->targets.contains(std::string("prod")) ? "yes" : "no") << "\n";
+    }
+
+    YAML::Node yaml5 = YAML::Load(R"(
+        targets: [prod, prod]
+        features: [search, billing, search]
+    )");
+
+    auto [deploy2, result5] = meta::fromYamlWithValidation<DeployConfig>(yaml5);
+    if (!deploy2) {
+        std::cout << "✗ Parse failed (expected):\n";
+        for (const auto& [field, error] : result5.errors) {
+            std::cout << "  " << field << ": " << error << "\n";
+        }
+    }
+
     std::cout << "\n=== Done ===\n";
     return 0;
 }
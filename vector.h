@@ -1,7 +1,18 @@
 #pragma once
 
 #include "meta.h"
+#include "flat_set.h"
+#include "inline_vector.h"
+#include "unique.h"
+#include <algorithm>
 #include <array>
+#include <concepts>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
 #include <vector>
 #include <stdexcept>
 
@@ -11,22 +22,82 @@ namespace meta {
 // WHITELISTED VECTOR - Like ContainersMap but for vectors
 // ============================================================================
 
-template<typename T, const auto& AllowedValues>
+// Duplicates = UniqueElements rejects a value that is already present. The
+// check is a bit per whitelist entry, indexed by the entry the value
+// matched, so it costs nothing beyond the whitelist lookup itself. The
+// elements are then read-only once added (const operator[], const
+// iterators only), since writing through them would leave the bits stale.
+template<typename T, const auto& AllowedValues, typename Container = std::vector<T>,
+         typename Duplicates = AllowDuplicates>
 class WhitelistVector {
 public:
     using value_type = T;
+    using allocator_type = allocator_of_t<Container>;
+
+    WhitelistVector() = default;
+
+    template<typename Alloc>
+        requires std::constructible_from<Container, const Alloc&>
+    explicit WhitelistVector(const Alloc& alloc) : data_(alloc) {}
+    
+    void push_back(const T& value) { append(value); }
+    void push_back(T&& value) { append(std::move(value)); }
+
+    // Binary search with a FlatSet container, linear scan otherwise
+    template<typename Q>
+    bool contains(const Q& value) const {
+        if constexpr (requires { data_.contains(value); }) {
+            return data_.contains(value);
+        } else {
+            return std::find(data_.begin(), data_.end(), value) != data_.end();
+        }
+    }
+
+    size_t size() const { return data_.size(); }
+    bool empty() const { return data_.empty(); }
     
-    void push_back(const T& value) {
+    auto begin()
+        requires(!is_unique_v<Duplicates>)
+    {
+        return data_.begin();
+    }
+    auto end()
+        requires(!is_unique_v<Duplicates>)
+    {
+        return data_.end();
+    }
+    auto begin() const { return data_.begin(); }
+    auto end() const { return data_.end(); }
+    
+    const T& operator[](size_t i) const { return data_[i]; }
+    T& operator[](size_t i)
+        requires(!is_unique_v<Duplicates>)
+    {
+        return data_[i];
+    }
+
+    allocator_type get_allocator() const
+        requires(!std::is_void_v<allocator_type>)
+    {
+        return data_.get_allocator();
+    }
+
+private:
+    // One bit per whitelist entry already present (UniqueElements only)
+    using SeenBits = std::array<uint64_t, (std::size(AllowedValues) + 63) / 64>;
+
+    Container data_;
+    [[no_unique_address]] std::conditional_t<is_unique_v<Duplicates>, SeenBits, std::monostate> seen_{};
+
+    template<typename U>
+    void append(U&& value) {
         // Validate value
-        bool found = false;
-        for (const auto& allowed : AllowedValues) {
-            if (value == allowed) {
-                found = true;
-                break;
-            }
+        size_t index = 0;
+        while (index < AllowedValues.size() && !(value == AllowedValues[index])) {
+            index++;
         }
         
-        if (!found) {
+        if (index == AllowedValues.size()) {
             std::string msg = "Value not allowed. Valid values: {";
             for (size_t i = 0; i < AllowedValues.size(); i++) {
                 if (i > 0) msg += ", ";
@@ -35,49 +106,63 @@ public:
             msg += "}";
             throw std::runtime_error(msg);
         }
-        
-        data_.push_back(value);
-    }
 
-    size_t size() const { return data_.size(); }
-    bool empty() const { return data_.empty(); }
-    
-    auto begin() { return data_.begin(); }
-    auto end() { return data_.end(); }
-    auto begin() const { return data_.begin(); }
-    auto end() const { return data_.end(); }
-    
-    const T& operator[](size_t i) const { return data_[i]; }
-    T& operator[](size_t i) { return data_[i]; }
+        if constexpr (is_unique_v<Duplicates>) {
+            uint64_t bit = uint64_t{1} << (index % 64);
+            if (seen_[index / 64] & bit) {
+                throw std::runtime_error("Duplicate value: " + std::string(AllowedValues[index]));
+            }
+        }
+        
+        data_.push_back(std::forward<U>(value));
 
-private:
-    std::vector<T> data_;
+        // Only once the value is in: a push that throws (e.g. an InlineVector
+        // at capacity) must not leave it marked as seen
+        if constexpr (is_unique_v<Duplicates>) {
+            seen_[index / 64] |= uint64_t{1} << (index % 64);
+        }
+    }
 };
 
 // ============================================================================
 // REGISTER WHITELISTED VECTOR WITH FRAMEWORK
 // ============================================================================
 
-template<typename T, const auto& AllowedValues>
-struct YamlTraits<WhitelistVector<T, AllowedValues>> {
-    using type = WhitelistVector<T, AllowedValues>;
+template<typename T, const auto& AllowedValues, typename Container, typename Duplicates>
+struct YamlTraits<WhitelistVector<T, AllowedValues, Container, Duplicates>> {
+    using type = WhitelistVector<T, AllowedValues, Container, Duplicates>;
     
-    static void parse(WhitelistVector<T, AllowedValues>& obj, const YAML::Node& node) {
+    static void parse(WhitelistVector<T, AllowedValues, Container, Duplicates>& obj, const YAML::Node& node) {
         if (!node.IsSequence()) {
             throw std::runtime_error("Expected sequence node for WhitelistVector");
         }
+        // Inline storage: reject an oversize sequence before decoding anything
+        if constexpr (requires { Container::static_capacity; }) {
+            if (node.size() > Container::static_capacity) {
+                throw std::runtime_error(
+                    "Sequence of " + std::to_string(node.size()) + 
+                    " exceeds WhitelistVector capacity " + 
+                    std::to_string(Container::static_capacity)
+                );
+            }
+        }
         for (const auto& item : node) {
-            T value = item.as<T>();
-            obj.push_back(value);  // Validates value automatically
+            // Validates value automatically; an allocator-aware element is
+            // decoded with the vector's allocator and moved in
+            if constexpr (std::is_void_v<allocator_of_t<Container>>) {
+                obj.push_back(nodeAs<T>(item));
+            } else {
+                obj.push_back(nodeAs<T>(item, obj.get_allocator()));
+            }
         }
     }
     
-    static std::string toString(const WhitelistVector<T, AllowedValues>& obj) {
+    static std::string toString(const WhitelistVector<T, AllowedValues, Container, Duplicates>& obj) {
         std::string result = "[";
         bool first = true;
         for (const auto& v : obj) {
             if (!first) result += ", ";
-            result += std::string(v);
+            result += std::string_view(v);
             first = false;
         }
         result += "]";
@@ -85,4 +170,23 @@ struct YamlTraits<WhitelistVector<T, AllowedValues>> {
     }
 };
 
+// Elements stored inside the object, at most N of them
+template<typename T, const auto& AllowedValues, size_t N>
+using InlineWhitelistVector = WhitelistVector<T, AllowedValues, InlineVector<T, N>>;
+
+// Each whitelisted value at most once, kept sorted for binary-search contains()
+template<typename T, const auto& AllowedValues>
+using WhitelistSet = WhitelistVector<T, AllowedValues, FlatSet<T>, UniqueElements>;
+
+// ============================================================================
+// STD::PMR VARIANT
+// ============================================================================
+
+namespace pmr {
+
+template<typename T, const auto& AllowedValues>
+using WhitelistVector = meta::WhitelistVector<T, AllowedValues, std::pmr::vector<T>>;
+
+}  // namespace pmr
+
 }  // namespace meta
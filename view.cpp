@@ -0,0 +1,92 @@
+#include "meta.h"
+#include "bounded.h"
+#include "view.h"
+#include <iostream>
+#include <type_traits>
+
+// ============================================================================
+// REQUEST-SCOPED STRUCT
+// ============================================================================
+
+struct Filter {
+    std::string field;
+    std::string op;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Filter::field>("field", "Column", meta::RequiredField),
+        meta::Field<&Filter::op>("op", "Operator", meta::RequiredField)
+    };
+};
+
+struct Query {
+    std::string table;
+    meta::BoundedInt<1, 1000> limit{100};
+    std::vector<std::string> columns;
+    Filter where;
+
+    static constexpr auto fields = std::tuple{
+        meta::Field<&Query::table>("table", "Table to read", meta::RequiredField),
+        meta::Field<&Query::limit>("limit", "Row limit", meta::OptionalField),
+        meta::Field<&Query::columns>("columns", "Columns to return", meta::OptionalField),
+        meta::Field<&Query::where>("where", "Row filter", meta::OptionalField)
+    };
+};
+
+static_assert(std::is_trivially_copyable_v<meta::YamlView<Query>>);
+
+// ============================================================================
+// USAGE
+// ============================================================================
+
+int main() {
+    std::cout << "=== YamlView ===\n\n";
+
+    const std::string body = R"(# request body
+table: orders
+columns:
+  - id
+  - total
+where:
+  field: status
+  op: eq
+limit: 5000
+)";
+
+    // ========================================
+    // Index once, decode what is asked for
+    // ========================================
+    std::cout << "--- Block Style ---\n";
+
+    meta::YamlView<Query> view(body);
+
+    auto [table, r1] = view.get<&Query::table>();
+    std::cout << "✓ table = " << *table << "\n";
+
+    auto [columns, r2] = view.get<&Query::columns>();
+    std::cout << "✓ " << columns->size() << " columns, raw text:\n" << view.raw<&Query::columns>() << "\n";
+
+    auto [where, r3] = view.get<&Query::where>();
+    std::cout << "✓ where " << where->field << " " << where->op << "\n";
+
+    auto [limit, r4] = view.get<&Query::limit>();
+    for (const auto& [field, msg] : r4.errors) {
+        std::cout << "✗ " << field << ": " << msg << "\n";
+    }
+
+    // Copies are just offsets into the same text
+    meta::YamlView<Query> copy = view;
+    std::cout << "  copy sees table: " << copy.raw<&Query::table>() << "\n";
+
+    // ========================================
+    // Flow style and absent keys
+    // ========================================
+    std::cout << "\n--- Flow Style ---\n";
+
+    meta::YamlView<Query> flow(std::string_view(R"({table: "users", where: {field: age, op: gt}})"));
+    std::cout << "  raw where: " << flow.raw<&Query::where>() << "\n";
+    std::cout << "  has limit: " << (flow.contains<&Query::limit>() ? "yes" : "no")
+              << ", default " << flow.get<&Query::limit>().first->value() << "\n";
+
+    std::cout << "\n=== Done ===\n";
+    return 0;
+}
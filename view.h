@@ -0,0 +1,247 @@
+#pragma once
+
+#include "meta.h"
+#include "extract.h"
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
+
+namespace meta {
+
+// ============================================================================
+// YAML VIEW - typed, read-only access to a document left as text
+// ============================================================================
+//
+//   meta::YamlView<Request> view(body);            // one indexing pass
+//   auto [limit, result] = view.get<&Request::limit>();
+//
+// Construction runs the event parser over the text once and records, for
+// each top-level key that names one of T::fields, the byte range of its
+// value; it stops as soon as every field has been located. After that the
+// view is a string_view and a fixed array of offsets: trivially copyable,
+// never allocating. get<&T::f>() decodes just that range, every time it
+// is called (nothing is cached), with the same checks fromYamlWithValidation
+// applies to the field. The text must outlive the view.
+//
+// Values may not use aliases whose anchors are outside their own range.
+//
+
+namespace detail {
+
+struct ValueSpan {
+    size_t begin = 0;
+    size_t end = 0;
+    bool present = false;
+};
+
+// Records the value range of each wanted top-level key
+class TopLevelIndexer : public YAML::EventHandler {
+public:
+    TopLevelIndexer(std::string_view text, std::span<const std::string_view> names, std::span<ValueSpan> spans)
+        : text_(text), names_(names), spans_(spans) {}
+
+    bool flow() const { return flow_; }
+
+    // Closes the last open range at the end of the text
+    void finish() { close(text_.size()); }
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override { throw ExtractStop{}; }
+
+    void OnNull(const YAML::Mark& mark, YAML::anchor_t) override { onNode(mark, false); }
+    void OnAlias(const YAML::Mark& mark, YAML::anchor_t) override { onNode(mark, false); }
+
+    void OnScalar(const YAML::Mark& mark, const std::string&, YAML::anchor_t, const std::string& value) override {
+        if (depth_ == 1 && expectKey_) {
+            onKey(mark, value);
+            return;
+        }
+        onNode(mark, false);
+    }
+
+    void OnSequenceStart(const YAML::Mark& mark, const std::string&, YAML::anchor_t,
+                         YAML::EmitterStyle::value) override {
+        onNode(mark, true);
+    }
+
+    void OnMapStart(const YAML::Mark& mark, const std::string&, YAML::anchor_t,
+                    YAML::EmitterStyle::value style) override {
+        if (depth_ == 0) {
+            flow_ = style == YAML::EmitterStyle::Flow;
+            depth_ = 1;
+            expectKey_ = true;
+            return;
+        }
+        onNode(mark, true);
+    }
+
+    void OnSequenceEnd() override { onEnd(); }
+
+    void OnMapEnd() override {
+        if (depth_ == 1) {
+            finish();
+            throw ExtractStop{};
+        }
+        onEnd();
+    }
+
+private:
+    std::string_view text_;
+    std::span<const std::string_view> names_;
+    std::span<ValueSpan> spans_;
+    bool flow_ = false;
+
+    size_t depth_ = 0;
+    bool expectKey_ = false;
+    size_t found_ = 0;
+    std::optional<size_t> pending_;   // field whose value comes next
+    std::optional<size_t> open_;      // field whose range is still open
+    size_t keyLine_ = 0;
+
+    static size_t position(const YAML::Mark& mark) { return static_cast<size_t>(mark.pos); }
+
+    size_t lineStart(size_t pos) const {
+        size_t newline = text_.rfind('\n', pos == 0 ? 0 : pos - 1);
+        return newline == std::string_view::npos ? 0 : newline + 1;
+    }
+
+    void onKey(const YAML::Mark& mark, std::string_view key) {
+        close(flow_ ? position(mark) : lineStart(position(mark)));
+        if (found_ == spans_.size()) throw ExtractStop{};
+
+        expectKey_ = false;
+        keyLine_ = static_cast<size_t>(mark.line);
+        for (size_t i = 0; i < names_.size(); i++) {
+            if (names_[i] == key && !spans_[i].present) {
+                pending_ = i;
+                break;
+            }
+        }
+    }
+
+    // First event of a node; container starts open a level
+    void onNode(const YAML::Mark& mark, bool container) {
+        if (depth_ == 0) throw std::runtime_error("YamlView: document root is not a mapping");
+        if (depth_ == 1) {
+            if (expectKey_) {
+                pending_.reset();  // complex key, never a field name
+            } else if (pending_) {
+                // A value starting on a later line is re-read with its
+                // indentation so the block structure survives
+                size_t begin = position(mark);
+                if (!flow_ && static_cast<size_t>(mark.line) != keyLine_) begin = lineStart(begin);
+                spans_[*pending_] = {begin, begin, true};
+                open_ = pending_;
+                pending_.reset();
+                found_++;
+            }
+            if (!container) expectKey_ = !expectKey_;
+        }
+        if (container) depth_++;
+    }
+
+    void onEnd() {
+        if (--depth_ == 1) expectKey_ = !expectKey_;
+    }
+
+    void close(size_t end) {
+        if (!open_) return;
+        ValueSpan& span = spans_[*open_];
+        while (end > span.begin && isSpace(text_[end - 1])) end--;
+        if (flow_ && end > span.begin && (text_[end - 1] == ',' || text_[end - 1] == '}')) {
+            end--;  // the separator (or closing brace) after the value
+            while (end > span.begin && isSpace(text_[end - 1])) end--;
+        }
+        span.end = end < span.begin ? span.begin : end;
+        open_.reset();
+    }
+
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+};
+
+}  // namespace detail
+
+template<HasFields T>
+class YamlView {
+public:
+    YamlView() = default;
+
+    explicit YamlView(std::string_view source) : source_(source) {
+        ViewStreamBuf buffer(source);
+        std::istream in(&buffer);
+        detail::TopLevelIndexer indexer(source, names_, spans_);
+        try {
+            YAML::Parser parser(in);
+            parser.HandleNextDocument(indexer);
+            indexer.finish();
+        } catch (const detail::ExtractStop&) {
+        }
+    }
+
+    std::string_view source() const { return source_; }
+
+    template<auto Member>
+    bool contains() const {
+        return spans_[index<Member>()].present;
+    }
+
+    // Source text of the member's value (empty if absent)
+    template<auto Member>
+    std::string_view raw() const {
+        const detail::ValueSpan& span = spans_[index<Member>()];
+        return source_.substr(span.begin, span.end - span.begin);
+    }
+
+    template<auto Member>
+    auto get() const
+        -> std::pair<std::optional<typename detail::field_at_t<T, fieldIndex<T, Member>()>::type>, ValidationResult> {
+        constexpr size_t I = index<Member>();
+        using FieldT = detail::field_at_t<T, I>;
+
+        ValidationResult result;
+        YAML::Node wrapper(YAML::NodeType::Map);
+        if (spans_[I].present) {
+            std::string_view text = raw<Member>();
+            try {
+                ViewStreamBuf buffer(text);
+                std::istream in(&buffer);
+                YAML::Node value = YAML::Load(in);
+                wrapper[std::get<I>(T::fields).fieldName] = value ? value : YAML::Node(YAML::NodeType::Null);
+            } catch (const std::exception& e) {
+                result.addError(std::get<I>(T::fields).fieldName, std::string("Parse error: ") + e.what());
+                return {std::nullopt, result};
+            }
+        }
+
+        T parent{};
+        detail::parseField<T, ParseMode::CollectAll, std::index_sequence<>, I>(parent, wrapper, result);
+        if (!result.valid) return {std::nullopt, result};
+        return {std::move(parent.*FieldT::memberPtr), result};
+    }
+
+private:
+    static constexpr std::array<std::string_view, field_count_v<T>> names_ =
+        []<size_t... I>(std::index_sequence<I...>) {
+            return std::array<std::string_view, field_count_v<T>>{std::get<I>(T::fields).fieldName...};
+        }(std::make_index_sequence<field_count_v<T>>{});
+
+    std::string_view source_;
+    std::array<detail::ValueSpan, field_count_v<T>> spans_{};
+
+    template<auto Member>
+    static consteval size_t index() {
+        constexpr size_t I = fieldIndex<T, Member>();
+        static_assert(I < field_count_v<T>, "Member is not listed in T::fields");
+        return I;
+    }
+};
+
+}  // namespace meta